@@ -0,0 +1,224 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Checks that SIMDFilterChain gives exactly the same output as the chain of
+    juce::dsp::IIR::Filter sections it replaced, one ProcessorChain per
+    channel, given the same coefficients:
+
+        SimpleEQBitExactness
+
+    White noise is run through both in float and double, for every slope and
+    for channel counts that fill, split and leave part of a SIMD register
+    empty, in blocks of varying size with the band settings changing between
+    blocks. Every stage stays switched on, as a stage fading in or out is
+    meant to differ from the plain chain. The noise never goes quiet, so the
+    silence skip never kicks in.
+
+    Built twice by CMake, once as is and once with JUCE_USE_SIMD=0, so both
+    the SIMD path and the scalar fallback are covered. Exits with 1 on the
+    first sample that differs.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/CoefficientDesign.h"
+#include "../../Source/SIMDFilterChain.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int maximumBlockSize = 512;
+    constexpr int numBlocks = 200;
+
+    // Includes counts that leave part of the last SIMD register empty.
+    constexpr std::array<int, 7> channelCounts{ 1, 2, 3, 4, 5, 8, 13 };
+
+    // The LOW_GAIN and HIGH_GAIN choice indices, 12 to 48 dB/Oct.
+    constexpr std::array<int, 4> slopes{ 0, 1, 2, 3 };
+
+    // The processor's old mono chain: low cut, peak, high cut.
+    template <typename SampleType>
+    struct ReferenceChain
+    {
+        using Filter = juce::dsp::IIR::Filter<SampleType>;
+        using CutFilter = juce::dsp::ProcessorChain<Filter, Filter, Filter, Filter>;
+
+        juce::dsp::ProcessorChain<CutFilter, Filter, CutFilter> chain;
+    };
+
+    // Normalised exactly as FilterCascade does it, then passed on with a0 = 1
+    // so IIR::Coefficients leaves them as they are.
+    template <typename SampleType>
+    typename juce::dsp::IIR::Coefficients<SampleType>::Ptr makeReferenceCoefficients(const CoefficientArray& coefficients)
+    {
+        auto section = BiquadCoefficients<SampleType>::fromArray(coefficients);
+
+        return new juce::dsp::IIR::Coefficients<SampleType>(section.b0, section.b1, section.b2,
+                                                            static_cast<SampleType>(1), section.a1, section.a2);
+    }
+
+    template <typename SampleType, int Index, typename CutFilter>
+    void updateReferenceCutSection(CutFilter& cut, const CutCoefficients& coefficients)
+    {
+        cut.template setBypassed<Index>(Index >= coefficients.numSections);
+
+        if (Index < coefficients.numSections)
+            cut.template get<Index>().coefficients = makeReferenceCoefficients<SampleType>(coefficients.sections[Index]);
+    }
+
+    template <typename SampleType, typename CutFilter>
+    void updateReferenceCut(CutFilter& cut, const CutCoefficients& coefficients)
+    {
+        updateReferenceCutSection<SampleType, 0>(cut, coefficients);
+        updateReferenceCutSection<SampleType, 1>(cut, coefficients);
+        updateReferenceCutSection<SampleType, 2>(cut, coefficients);
+        updateReferenceCutSection<SampleType, 3>(cut, coefficients);
+    }
+
+    struct Settings
+    {
+        CutCoefficients lowCut, highCut;
+        CoefficientArray peak{};
+    };
+
+    Settings makeSettings(juce::Random& random, int slope)
+    {
+        auto order = (slope + 1) * 2;
+
+        Settings settings;
+        makeLowCutCoefficients(settings.lowCut, sampleRate, 20.f + random.nextFloat() * 480.f, order);
+        makeHighCutCoefficients(settings.highCut, sampleRate, 2000.f + random.nextFloat() * 18000.f, order);
+        settings.peak = makePeakCoefficients(sampleRate,
+                                             100.f + random.nextFloat() * 9900.f,
+                                             0.3f + random.nextFloat() * 5.f,
+                                             random.nextFloat() * 48.f - 24.f);
+
+        return settings;
+    }
+
+    template <typename SampleType>
+    void applySettings(const Settings& settings, SIMDFilterChain<SampleType>& chain,
+                       std::vector<ReferenceChain<SampleType>>& references)
+    {
+        chain.setLowCutCoefficients(settings.lowCut);
+        chain.setPeakCoefficients(settings.peak);
+        chain.setHighCutCoefficients(settings.highCut);
+
+        for (auto& reference : references)
+        {
+            updateReferenceCut<SampleType>(reference.chain.template get<0>(), settings.lowCut);
+            reference.chain.template get<1>().coefficients = makeReferenceCoefficients<SampleType>(settings.peak);
+            updateReferenceCut<SampleType>(reference.chain.template get<2>(), settings.highCut);
+        }
+    }
+
+    // Returns whether every sample matched.
+    template <typename SampleType>
+    bool runCase(int numChannels, int slope)
+    {
+        juce::Random random(numChannels * 10 + slope);
+
+        juce::dsp::ProcessSpec spec{ sampleRate, static_cast<juce::uint32>(maximumBlockSize), static_cast<juce::uint32>(numChannels) };
+        juce::dsp::ProcessSpec monoSpec{ sampleRate, static_cast<juce::uint32>(maximumBlockSize), 1 };
+
+        SIMDFilterChain<SampleType> chain;
+        chain.prepare(spec);
+
+        std::vector<ReferenceChain<SampleType>> references(static_cast<size_t>(numChannels));
+
+        for (auto& reference : references)
+            reference.chain.prepare(monoSpec);
+
+        applySettings(makeSettings(random, slope), chain, references);
+
+        // Reset after the stages are switched on, so they start out in place
+        // rather than fading in.
+        for (auto stage : { LowCut, Peak, HighCut })
+            chain.setStageEnabled(stage, true);
+
+        chain.reset();
+
+        for (auto& reference : references)
+            reference.chain.reset();
+
+        juce::AudioBuffer<SampleType> buffer(numChannels, maximumBlockSize);
+        juce::AudioBuffer<SampleType> expected(numChannels, maximumBlockSize);
+
+        for (int blockIndex = 0; blockIndex < numBlocks; blockIndex++)
+        {
+            // Same slope, so the layout of the cascade stays put.
+            if (blockIndex % 10 == 9)
+                applySettings(makeSettings(random, slope), chain, references);
+
+            auto numSamples = 1 + random.nextInt(maximumBlockSize);
+
+            for (int channel = 0; channel < numChannels; channel++)
+                for (int i = 0; i < numSamples; i++)
+                    buffer.setSample(channel, i, static_cast<SampleType>(random.nextFloat() * 0.5f - 0.25f));
+
+            for (int channel = 0; channel < numChannels; channel++)
+                expected.copyFrom(channel, 0, buffer, channel, 0, numSamples);
+
+            juce::dsp::AudioBlock<SampleType> block(buffer.getArrayOfWritePointers(), static_cast<size_t>(numChannels), static_cast<size_t>(numSamples));
+            chain.process(juce::dsp::ProcessContextReplacing<SampleType>(block));
+
+            juce::dsp::AudioBlock<SampleType> expectedBlock(expected.getArrayOfWritePointers(), static_cast<size_t>(numChannels), static_cast<size_t>(numSamples));
+
+            for (int channel = 0; channel < numChannels; channel++)
+            {
+                auto channelBlock = expectedBlock.getSingleChannelBlock(static_cast<size_t>(channel));
+                references[static_cast<size_t>(channel)].chain.process(juce::dsp::ProcessContextReplacing<SampleType>(channelBlock));
+            }
+
+            for (int channel = 0; channel < numChannels; channel++)
+            {
+                for (int i = 0; i < numSamples; i++)
+                {
+                    if (buffer.getSample(channel, i) == expected.getSample(channel, i))
+                        continue;
+
+                    std::cerr << (std::is_same<SampleType, float>::value ? "float" : "double")
+                              << ", " << numChannels << " channels, slope " << slope
+                              << ": block " << blockIndex << ", channel " << channel << ", sample " << i
+                              << " is " << buffer.getSample(channel, i)
+                              << ", expected " << expected.getSample(channel, i) << std::endl;
+
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename SampleType>
+    bool runAllCases()
+    {
+        for (auto numChannels : channelCounts)
+            for (auto slope : slopes)
+                if (!runCase<SampleType>(numChannels, slope))
+                    return false;
+
+        return true;
+    }
+}
+
+int main ()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+   #if JUCE_USE_SIMD
+    std::cout << "SIMDFilterChain with " << SIMDFilterChain<float>::numLanes << " float lanes" << std::endl;
+   #else
+    std::cout << "SIMDFilterChain scalar fallback" << std::endl;
+   #endif
+
+    if (!runAllCases<float>() || !runAllCases<double>())
+        return 1;
+
+    std::cout << "Bit exact" << std::endl;
+    return 0;
+}
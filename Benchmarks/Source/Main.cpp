@@ -0,0 +1,349 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Microbenchmarks for the DSP hot path, written out as JSON:
+
+        SimpleEQBenchmarks [--output <file>] [--repeats <n>]
+
+    processBlock is timed in float and double at every oversampling factor,
+    for every combination of block size, sample rate, slope and channel
+    count, in steady state on white noise with every band active.
+
+    updateMonoChains, updateCutFilters and updatePeakFilter are timed per
+    call once for each sample rate and slope, each call following a
+    parameter change so it does a real redesign. The block size makes no
+    difference to them, so they get one result each, with block_size 0.
+    Its ns_per_sample_by_block_size spreads the one call over a block of
+    each size, as it would be paid at most once per block.
+
+    FilterCascade::getFrequencyResponse is timed per point over log spaced
+    grids of several sizes, with magnitude, phase and group delay all asked
+    for, on the mono chain of each slope.
+
+    Every figure is the best of --repeats timed runs (3 by default), after
+    one untimed warm up run.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    constexpr std::array<int, 5> blockSizes{ 16, 64, 256, 1024, 4096 };
+    constexpr std::array<double, 4> sampleRates{ 44100.0, 48000.0, 96000.0, 192000.0 };
+    constexpr std::array<int, 3> channelCounts{ 1, 2, 8 };
+
+    // The LOW_GAIN and HIGH_GAIN choice indices, 12 to 48 dB/Oct.
+    constexpr std::array<int, 4> slopes{ 0, 1, 2, 3 };
+
+    // The OVERSAMPLING choice indices, 1x to 4x.
+    constexpr std::array<int, 3> oversamplingChoices{ 0, 1, 2 };
+
+    // Points per getFrequencyResponse call.
+    constexpr std::array<int, 3> gridSizes{ 256, 1024, 8192 };
+
+    // Frames per timed processBlock run, whatever the block size.
+    constexpr int framesPerRun = 1 << 16;
+    constexpr int callsPerRun = 1000;
+
+    using Clock = std::chrono::steady_clock;
+
+    double toNanoseconds(Clock::duration duration)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    void setParameter(SimpleEQAudioProcessor& processor, const juce::String& id, float value)
+    {
+        auto* parameter = processor.apvts.getParameter(id);
+        jassert(parameter != nullptr);
+
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    std::unique_ptr<SimpleEQAudioProcessor> createProcessor(double sampleRate, int blockSize, int numChannels, int slope)
+    {
+        auto processor = std::make_unique<SimpleEQAudioProcessor>();
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(juce::AudioChannelSet::canonicalChannelSet(numChannels));
+        layout.outputBuses.add(juce::AudioChannelSet::canonicalChannelSet(numChannels));
+        processor->setBusesLayout(layout);
+
+        // Nothing at a neutral setting, so no band is dropped from the cascade.
+        setParameter(*processor, LOW_CUT, 80.f);
+        setParameter(*processor, HIGH_CUT, 12000.f);
+        setParameter(*processor, LOW_GAIN, static_cast<float>(slope));
+        setParameter(*processor, HIGH_GAIN, static_cast<float>(slope));
+        setParameter(*processor, PEAK_FREQ, 1000.f);
+        setParameter(*processor, PEAK_GAIN, 6.f);
+        setParameter(*processor, PEAK_QUALITY, 1.f);
+
+        processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor->prepareToPlay(sampleRate, blockSize);
+
+        return processor;
+    }
+
+    // Returns nanoseconds per frame.
+    template <typename SampleType>
+    double timeProcessBlock(SimpleEQAudioProcessor& processor, int blockSize, int numChannels, int repeats)
+    {
+        // Fresh input for every block, as filtering the same buffer over and
+        // over would eventually blow up or die away to silence.
+        juce::Random random(1);
+        juce::AudioBuffer<SampleType> noise(numChannels, framesPerRun);
+
+        for (int channel = 0; channel < numChannels; channel++)
+            for (int i = 0; i < framesPerRun; i++)
+                noise.setSample(channel, i, static_cast<SampleType>(random.nextFloat() * 0.5f - 0.25f));
+
+        juce::AudioBuffer<SampleType> buffer(numChannels, blockSize);
+        juce::MidiBuffer midi;
+
+        auto best = std::numeric_limits<double>::max();
+
+        for (int run = 0; run <= repeats; run++)
+        {
+            Clock::duration elapsed{};
+
+            for (int start = 0; start + blockSize <= framesPerRun; start += blockSize)
+            {
+                for (int channel = 0; channel < numChannels; channel++)
+                    buffer.copyFrom(channel, 0, noise, channel, start, blockSize);
+
+                auto startTime = Clock::now();
+                processor.processBlock(buffer, midi);
+                elapsed += Clock::now() - startTime;
+            }
+
+            if (run > 0)
+                best = juce::jmin(best, toNanoseconds(elapsed));
+        }
+
+        return best / ((framesPerRun / blockSize) * blockSize);
+    }
+
+    // Returns nanoseconds per call of update, with change(bool) run untimed
+    // before each one to move the parameters it depends on.
+    template <typename ChangeFunction, typename UpdateFunction>
+    double timeUpdates(ChangeFunction&& change, UpdateFunction&& update, int repeats)
+    {
+        auto best = std::numeric_limits<double>::max();
+
+        for (int run = 0; run <= repeats; run++)
+        {
+            Clock::duration elapsed{};
+
+            for (int i = 0; i < callsPerRun; i++)
+            {
+                change(i % 2 == 0);
+
+                auto startTime = Clock::now();
+                update();
+                elapsed += Clock::now() - startTime;
+            }
+
+            if (run > 0)
+                best = juce::jmin(best, toNanoseconds(elapsed));
+        }
+
+        return best / callsPerRun;
+    }
+
+    juce::var createMachineInfo()
+    {
+        auto* machine = new juce::DynamicObject();
+
+        machine->setProperty("date", juce::Time::getCurrentTime().toISO8601(true));
+        machine->setProperty("cpu", juce::SystemStats::getCpuModel());
+        machine->setProperty("num_cpus", juce::SystemStats::getNumCpus());
+        machine->setProperty("os", juce::SystemStats::getOperatingSystemName());
+        machine->setProperty("juce", juce::SystemStats::getJUCEVersion());
+        machine->setProperty("simd", JUCE_USE_SIMD != 0);
+
+        return machine;
+    }
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::File outputFile;
+    int repeats = 3;
+
+    for (int i = 1; i < argc; i++)
+    {
+        juce::String arg(argv[i]);
+
+        if (arg == "--output" && i + 1 < argc)
+        {
+            outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        }
+        else if (arg == "--repeats" && i + 1 < argc)
+        {
+            repeats = juce::jmax(1, juce::String(argv[++i]).getIntValue());
+        }
+        else
+        {
+            std::cerr << "Usage: SimpleEQBenchmarks [--output <file>] [--repeats <n>]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Keeps the cut tables for every rate alive between processors, rather
+    // than rebuilding them for each one.
+    std::vector<std::shared_ptr<const CutFilterTable>> tables;
+
+    for (auto sampleRate : sampleRates)
+        for (auto oversampling : oversamplingChoices)
+            tables.push_back(CutFilterTable::getForSampleRate(sampleRate * (1 << oversampling)));
+
+    juce::Array<juce::var> results;
+
+    auto addResult = [&results](const juce::String& benchmark, double sampleRate, int blockSize, int numChannels,
+                                int slope, const juce::String& precision, int oversampling)
+    {
+        auto* result = new juce::DynamicObject();
+
+        result->setProperty("benchmark", benchmark);
+        result->setProperty("sample_rate", sampleRate);
+        result->setProperty("block_size", blockSize);
+        result->setProperty("channels", numChannels);
+        result->setProperty("slope_db_per_oct", (slope + 1) * 12);
+        result->setProperty("precision", precision);
+        result->setProperty("oversampling", 1 << oversampling);
+
+        results.add(juce::var(result));
+        return result;
+    };
+
+    for (auto sampleRate : sampleRates)
+    {
+        for (auto numChannels : channelCounts)
+        {
+            for (auto blockSize : blockSizes)
+            {
+                for (auto slope : slopes)
+                {
+                    std::cerr << "processBlock: " << sampleRate << " Hz, " << numChannels << " channels, "
+                              << blockSize << " samples, slope " << slope << std::endl;
+
+                    auto processor = createProcessor(sampleRate, blockSize, numChannels, slope);
+
+                    for (auto oversampling : oversamplingChoices)
+                    {
+                        // This is the message thread, so the chains are prepared
+                        // for the new factor before this returns.
+                        setParameter(*processor, OVERSAMPLING, static_cast<float>(oversampling));
+
+                        auto floatTime = timeProcessBlock<float>(*processor, blockSize, numChannels, repeats);
+                        auto* floatResult = addResult("processBlock", sampleRate, blockSize, numChannels, slope, "float", oversampling);
+                        floatResult->setProperty("ns_per_sample", floatTime);
+                        floatResult->setProperty("ns_per_channel_sample", floatTime / numChannels);
+
+                        auto doubleTime = timeProcessBlock<double>(*processor, blockSize, numChannels, repeats);
+                        auto* doubleResult = addResult("processBlock", sampleRate, blockSize, numChannels, slope, "double", oversampling);
+                        doubleResult->setProperty("ns_per_sample", doubleTime);
+                        doubleResult->setProperty("ns_per_channel_sample", doubleTime / numChannels);
+                    }
+                }
+            }
+        }
+    }
+
+    for (auto sampleRate : sampleRates)
+    {
+        for (auto slope : slopes)
+        {
+            std::cerr << "updates: " << sampleRate << " Hz, slope " << slope << std::endl;
+
+            auto processor = createProcessor(sampleRate, blockSizes.back(), 2, slope);
+            auto& p = *processor;
+
+            auto moveCuts = [&p](bool flip)
+            {
+                setParameter(p, LOW_CUT, flip ? 90.f : 80.f);
+                setParameter(p, HIGH_CUT, flip ? 11000.f : 12000.f);
+            };
+
+            auto movePeak = [&p](bool flip)
+            {
+                setParameter(p, PEAK_FREQ, flip ? 1100.f : 1000.f);
+            };
+
+            std::vector<std::pair<juce::String, double>> timings
+            {
+                { "updateMonoChains", timeUpdates([&](bool flip) { moveCuts(flip); movePeak(flip); }, [&p] { p.updateMonoChains(); }, repeats) },
+                { "updateCutFilters", timeUpdates(moveCuts, [&p] { p.updateCutFilters(); }, repeats) },
+                { "updatePeakFilter", timeUpdates(movePeak, [&p] { p.updatePeakFilter(); }, repeats) }
+            };
+
+            for (auto& [benchmark, nsPerCall] : timings)
+            {
+                auto* perSample = new juce::DynamicObject();
+
+                for (auto blockSize : blockSizes)
+                    perSample->setProperty(juce::String(blockSize), nsPerCall / blockSize);
+
+                auto* result = addResult(benchmark, sampleRate, 0, 2, slope, "float", 0);
+                result->setProperty("ns_per_call", nsPerCall);
+                result->setProperty("ns_per_sample_by_block_size", juce::var(perSample));
+            }
+
+            MonoChain chain;
+            p.updateMonoChain(chain);
+
+            for (auto numPoints : gridSizes)
+            {
+                std::vector<double> frequencies(static_cast<size_t>(numPoints));
+
+                for (int i = 0; i < numPoints; i++)
+                    frequencies[static_cast<size_t>(i)] = juce::mapToLog10<double>(double(i) / double(numPoints), 20.0, 20000.0);
+
+                ResponseGrid grid;
+                grid.setFrequencies(frequencies.data(), numPoints, sampleRate);
+
+                std::vector<double> magnitudes(frequencies.size()), phases(frequencies.size()), groupDelays(frequencies.size());
+                FrequencyResponse response{ magnitudes.data(), phases.data(), groupDelays.data() };
+
+                auto nsPerCall = timeUpdates([](bool) {}, [&] { chain.getFrequencyResponse(grid, response); }, repeats);
+
+                auto* result = addResult("getFrequencyResponse", sampleRate, 0, 1, slope, "float", 0);
+                result->setProperty("points", numPoints);
+                result->setProperty("ns_per_point", nsPerCall / numPoints);
+                result->setProperty("points_per_ms", 1.0e6 * numPoints / nsPerCall);
+            }
+        }
+    }
+
+    if (auto numViolations = RealtimeSafety::getNumViolations(); numViolations > 0)
+    {
+        std::cerr << numViolations << " real-time safety violations in processBlock" << std::endl;
+        return 1;
+    }
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("machine", createMachineInfo());
+    root->setProperty("results", results);
+
+    auto json = juce::JSON::toString(juce::var(root));
+
+    if (outputFile == juce::File())
+    {
+        std::cout << json << std::endl;
+    }
+    else if (!outputFile.replaceWithText(json))
+    {
+        std::cerr << "Can't write " << outputFile.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
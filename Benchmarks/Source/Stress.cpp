@@ -0,0 +1,259 @@
+/*
+  ==============================================================================
+
+    Stress.cpp
+    Created: 18 Oct 2026 8:41:05pm
+    Author:  User
+
+    Worst case block times under continuous automation:
+
+        SimpleEQStress [--output <file>] [--sample-rate <hz>] [--seconds <n>]
+                       [--seed <n>] [--max-load <fraction>]
+
+    For each buffer size a fresh processor is prepared and run for --seconds
+    of audio, with all seven EQ parameters moved before every block, the way
+    a host delivers automation. Each parameter alternates between ramps
+    towards a random target and sudden jumps, so the coefficient redesigns in
+    processBlock run on most blocks.
+
+    Every block is timed, starting with the first one after prepareToPlay,
+    and the distribution (p50/p99/p99.9/max) is reported against the real
+    time deadline for the buffer size. With --max-load the exit code is 1 if
+    any block takes longer than that fraction of its deadline.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    constexpr std::array<int, 7> blockSizes{ 32, 64, 128, 256, 512, 1024, 2048 };
+    constexpr int numChannels = 2;
+
+    // Chance per block that a parameter at rest jumps instead of ramping.
+    constexpr float jumpProbability = 0.2f;
+    constexpr int maxRampBlocks = 200;
+
+    using Clock = std::chrono::steady_clock;
+
+    // Moves one parameter in its normalised range: a ramp towards a random
+    // target over a random number of blocks, or a jump straight there.
+    class Automation
+    {
+    public:
+        explicit Automation(juce::RangedAudioParameter& p) : parameter(p), value(p.getValue()) {}
+
+        void advance(juce::Random& random)
+        {
+            if (remainingSteps == 0)
+            {
+                auto target = random.nextFloat();
+
+                if (random.nextFloat() < jumpProbability)
+                {
+                    value = target;
+                    step = 0.f;
+                }
+                else
+                {
+                    remainingSteps = 1 + random.nextInt(maxRampBlocks);
+                    step = (target - value) / remainingSteps;
+                }
+            }
+
+            if (remainingSteps > 0)
+            {
+                value = juce::jlimit(0.f, 1.f, value + step);
+                remainingSteps--;
+            }
+
+            parameter.setValueNotifyingHost(value);
+        }
+
+    private:
+        juce::RangedAudioParameter& parameter;
+        float value;
+        float step{ 0.f };
+        int remainingSteps{ 0 };
+    };
+
+    struct BlockTimes
+    {
+        std::vector<double> nanoseconds;
+        double firstBlock{ 0.0 };
+    };
+
+    BlockTimes runStress(double sampleRate, int blockSize, double seconds, juce::int64 seed)
+    {
+        SimpleEQAudioProcessor processor;
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(juce::AudioChannelSet::stereo());
+        layout.outputBuses.add(juce::AudioChannelSet::stereo());
+        processor.setBusesLayout(layout);
+
+        juce::Random random(seed);
+        std::vector<Automation> automations;
+
+        for (auto& id : { LOW_CUT, HIGH_CUT, LOW_GAIN, HIGH_GAIN, PEAK_FREQ, PEAK_GAIN, PEAK_QUALITY })
+            automations.emplace_back(*processor.apvts.getParameter(id));
+
+        processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        auto numBlocks = juce::jmax(1, juce::roundToInt(seconds * sampleRate / blockSize));
+
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+        juce::MidiBuffer midi;
+
+        BlockTimes times;
+        times.nanoseconds.reserve(static_cast<size_t>(numBlocks));
+
+        for (int block = 0; block < numBlocks; block++)
+        {
+            for (auto& automation : automations)
+                automation.advance(random);
+
+            // Fresh noise each block, so the silence skip never kicks in.
+            for (int channel = 0; channel < numChannels; channel++)
+                for (int i = 0; i < blockSize; i++)
+                    buffer.setSample(channel, i, random.nextFloat() * 0.5f - 0.25f);
+
+            auto startTime = Clock::now();
+            processor.processBlock(buffer, midi);
+            auto elapsed = Clock::now() - startTime;
+
+            times.nanoseconds.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+
+        times.firstBlock = times.nanoseconds.front();
+
+        return times;
+    }
+
+    // Nearest rank percentile of sorted values.
+    double percentile(const std::vector<double>& sorted, double p)
+    {
+        auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+        return sorted[juce::jlimit(static_cast<size_t>(0), sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+    }
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::File outputFile;
+    double sampleRate = 48000.0;
+    double seconds = 60.0;
+    juce::int64 seed = 1;
+    double maxLoad = 0.0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        juce::String arg(argv[i]);
+        auto nextArg = [&] { return i + 1 < argc ? juce::String(argv[++i]) : juce::String(); };
+
+        if (arg == "--output")
+        {
+            outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(nextArg());
+        }
+        else if (arg == "--sample-rate")
+        {
+            sampleRate = juce::jmax(8000.0, nextArg().getDoubleValue());
+        }
+        else if (arg == "--seconds")
+        {
+            seconds = juce::jmax(1.0, nextArg().getDoubleValue());
+        }
+        else if (arg == "--seed")
+        {
+            seed = nextArg().getLargeIntValue();
+        }
+        else if (arg == "--max-load")
+        {
+            maxLoad = nextArg().getDoubleValue();
+        }
+        else
+        {
+            std::cerr << "Usage: SimpleEQStress [--output <file>] [--sample-rate <hz>] [--seconds <n>]" << std::endl
+                      << "                      [--seed <n>] [--max-load <fraction>]" << std::endl;
+            return 1;
+        }
+    }
+
+    juce::Array<juce::var> results;
+    bool overLoad = false;
+
+    std::cout << "block    deadline       p50       p99     p99.9       max     first  overruns  (us)" << std::endl;
+
+    for (auto blockSize : blockSizes)
+    {
+        auto times = runStress(sampleRate, blockSize, seconds, seed);
+
+        auto sorted = times.nanoseconds;
+        std::sort(sorted.begin(), sorted.end());
+
+        auto deadline = blockSize / sampleRate * 1.0e9;
+        auto numOverruns = static_cast<int>(std::count_if(sorted.begin(), sorted.end(), [deadline](double t) { return t > deadline; }));
+
+        auto p50 = percentile(sorted, 0.5);
+        auto p99 = percentile(sorted, 0.99);
+        auto p999 = percentile(sorted, 0.999);
+        auto max = sorted.back();
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty("block_size", blockSize);
+        result->setProperty("num_blocks", static_cast<int>(sorted.size()));
+        result->setProperty("deadline_ns", deadline);
+        result->setProperty("p50_ns", p50);
+        result->setProperty("p99_ns", p99);
+        result->setProperty("p999_ns", p999);
+        result->setProperty("max_ns", max);
+        result->setProperty("first_block_ns", times.firstBlock);
+        result->setProperty("max_load", max / deadline);
+        result->setProperty("overruns", numOverruns);
+        results.add(juce::var(result));
+
+        auto micros = [](double ns) { return juce::String(ns / 1000.0, 1).paddedLeft(' ', 10); };
+
+        std::cout << juce::String(blockSize).paddedLeft(' ', 5) << "  " << micros(deadline) << micros(p50) << micros(p99)
+                  << micros(p999) << micros(max) << micros(times.firstBlock) << juce::String(numOverruns).paddedLeft(' ', 10) << std::endl;
+
+        if (maxLoad > 0.0 && max > deadline * maxLoad)
+            overLoad = true;
+    }
+
+    if (auto numViolations = RealtimeSafety::getNumViolations(); numViolations > 0)
+    {
+        std::cerr << numViolations << " real-time safety violations in processBlock" << std::endl;
+        return 1;
+    }
+
+    if (outputFile != juce::File())
+    {
+        auto* root = new juce::DynamicObject();
+        root->setProperty("sample_rate", sampleRate);
+        root->setProperty("seconds", seconds);
+        root->setProperty("seed", seed);
+        root->setProperty("cpu", juce::SystemStats::getCpuModel());
+        root->setProperty("results", results);
+
+        if (!outputFile.replaceWithText(juce::JSON::toString(juce::var(root))))
+        {
+            std::cerr << "Can't write " << outputFile.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+
+    if (overLoad)
+    {
+        std::cerr << "Worst case block time over " << maxLoad << " of the deadline" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    AnalyzerTap.cpp
+    Created: 19 Oct 2026 1:02:46am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "AnalyzerTap.h"
+
+AnalyzerTap::AnalyzerTap()
+{
+    for (auto& side : samples)
+        side.resize(static_cast<size_t>(fifoSize));
+}
+
+void AnalyzerTap::prepare(double newSampleRate)
+{
+    sampleRate.store(newSampleRate, std::memory_order_relaxed);
+}
+
+bool AnalyzerTap::attachReader()
+{
+    bool expected = false;
+
+    if (!readerAttached.compare_exchange_strong(expected, true))
+        return false;
+
+    // The reader owns the read side, so it can skip what's there.
+    for (auto& fifo : fifos)
+        fifo.finishedRead(fifo.getNumReady());
+
+    return true;
+}
+
+void AnalyzerTap::detachReader()
+{
+    readerAttached.store(false);
+}
+
+int AnalyzerTap::read(Side side, float* dest, int maxSamples)
+{
+    auto& fifo = fifos[side];
+    int start1, size1, start2, size2;
+
+    fifo.prepareToRead(maxSamples, start1, size1, start2, size2);
+
+    std::copy_n(samples[side].data() + start1, size1, dest);
+    std::copy_n(samples[side].data() + start2, size2, dest + size1);
+
+    fifo.finishedRead(size1 + size2);
+
+    return size1 + size2;
+}
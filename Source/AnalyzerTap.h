@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    AnalyzerTap.h
+    Created: 19 Oct 2026 1:02:46am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Carries the plugin's input and output, mixed to mono, from the audio thread
+// to the spectrum analyzer. Each side is a single producer, single consumer
+// FIFO: the audio thread only copies into it and never waits, and when the
+// reader falls behind the newest samples are dropped rather than blocking.
+//
+// Nothing is copied unless a reader is attached, so with no editor open the
+// audio thread's whole cost is one atomic load per push.
+class AnalyzerTap
+{
+public:
+    // About 0.7 seconds at 48 kHz, far more than a reader polling at the
+    // display rate ever leaves waiting.
+    static constexpr int fifoSize = 1 << 15;
+
+    enum Side
+    {
+        Input,
+        Output
+    };
+
+    AnalyzerTap();
+
+    // Call from prepareToPlay with the host rate.
+    void prepare(double sampleRate);
+    double getSampleRate() const { return sampleRate.load(std::memory_order_relaxed); }
+
+    // Audio thread only. Mixes the first numChannels channels of the buffer
+    // to mono and queues them.
+    template <typename SampleType>
+    void push(Side side, const juce::AudioBuffer<SampleType>& buffer, int numChannels) noexcept
+    {
+        if (!readerAttached.load(std::memory_order_relaxed))
+            return;
+
+        numChannels = juce::jmin(numChannels, buffer.getNumChannels());
+
+        if (numChannels <= 0)
+            return;
+
+        auto& fifo = fifos[side];
+        auto gain = 1.f / static_cast<float>(numChannels);
+        int start1, size1, start2, size2;
+
+        fifo.prepareToWrite(buffer.getNumSamples(), start1, size1, start2, size2);
+
+        mix(buffer, numChannels, gain, 0, samples[side].data() + start1, size1);
+        mix(buffer, numChannels, gain, size1, samples[side].data() + start2, size2);
+
+        fifo.finishedWrite(size1 + size2);
+    }
+
+    // Only one reader at a time. Returns false if another one already is.
+    // Anything left over from an earlier reader is dropped on attaching.
+    bool attachReader();
+    void detachReader();
+
+    // Reader only. Returns the number of samples copied, at most maxSamples.
+    int read(Side side, float* dest, int maxSamples);
+
+private:
+    template <typename SampleType>
+    static void mix(const juce::AudioBuffer<SampleType>& buffer, int numChannels, float gain,
+                    int sourceStart, float* dest, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return;
+
+        for (int i = 0; i < numSamples; i++)
+            dest[i] = 0.f;
+
+        for (int channel = 0; channel < numChannels; channel++)
+        {
+            auto* source = buffer.getReadPointer(channel, sourceStart);
+
+            for (int i = 0; i < numSamples; i++)
+                dest[i] += static_cast<float>(source[i]) * gain;
+        }
+    }
+
+    std::array<juce::AbstractFifo, 2> fifos{ juce::AbstractFifo(fifoSize), juce::AbstractFifo(fifoSize) };
+    std::array<std::vector<float>, 2> samples;
+
+    std::atomic<bool> readerAttached{ false };
+    std::atomic<double> sampleRate{ 44100.0 };
+
+    JUCE_DECLARE_NON_COPYABLE(AnalyzerTap)
+};
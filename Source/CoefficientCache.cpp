@@ -0,0 +1,193 @@
+/*
+  ==============================================================================
+
+    CoefficientCache.cpp
+    Created: 18 Oct 2026 11:03:17pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "CoefficientCache.h"
+
+namespace
+{
+    enum class DesignType : juce::int32
+    {
+        Peak,
+        LowCut,
+        HighCut
+    };
+
+    // Zero initialised in full, padding included, so keys can be compared
+    // and hashed as raw words.
+    struct Key
+    {
+        double sampleRate;
+        float frequency;
+        float quality;
+        float gainInDecibels;
+        juce::int32 typeAndOrder;
+    };
+
+    constexpr int numKeyWords = static_cast<int>(sizeof(Key) / sizeof(juce::uint64));
+    static_assert(sizeof(Key) % sizeof(juce::uint64) == 0);
+
+    // The largest design, a 48 dB/Oct cut, flattened.
+    constexpr int maxValues = static_cast<int>(std::tuple_size<CoefficientArray>::value) * 4;
+
+    struct Slot
+    {
+        // Odd while a writer owns the slot.
+        std::atomic<juce::uint32> sequence{ 0 };
+        std::array<std::atomic<juce::uint64>, numKeyWords> key{};
+        std::array<std::atomic<double>, maxValues> values{};
+    };
+
+    // Constant initialised, so there's no static guard for the audio thread
+    // to go through.
+    std::array<Slot, CoefficientCache::numSlots> slots;
+    std::atomic<juce::uint64> numHits{ 0 }, numMisses{ 0 };
+
+    Key makeKey(DesignType type, double sampleRate, float frequency, float quality, float gainInDecibels, int order)
+    {
+        Key key;
+        std::memset(&key, 0, sizeof(key));
+
+        key.sampleRate = sampleRate;
+        key.frequency = frequency;
+        key.quality = quality;
+        key.gainInDecibels = gainInDecibels;
+        key.typeAndOrder = static_cast<juce::int32>(type) << 16 | order;
+
+        return key;
+    }
+
+    std::array<juce::uint64, numKeyWords> getWords(const Key& key)
+    {
+        std::array<juce::uint64, numKeyWords> words;
+        std::memcpy(words.data(), &key, sizeof(key));
+        return words;
+    }
+
+    Slot& getSlot(const std::array<juce::uint64, numKeyWords>& words)
+    {
+        // Each key word folded in and mixed with splitmix64's finaliser.
+        juce::uint64 hash = 0;
+
+        for (auto word : words)
+        {
+            hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+            hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+            hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+            hash ^= hash >> 31;
+        }
+
+        return slots[static_cast<size_t>(hash % CoefficientCache::numSlots)];
+    }
+
+    bool lookup(const std::array<juce::uint64, numKeyWords>& words, double* dest, int numValues)
+    {
+        auto& slot = getSlot(words);
+        auto sequenceBefore = slot.sequence.load(std::memory_order_acquire);
+
+        if ((sequenceBefore & 1) != 0)
+            return false;
+
+        for (int i = 0; i < numKeyWords; i++)
+            if (slot.key[static_cast<size_t>(i)].load(std::memory_order_relaxed) != words[static_cast<size_t>(i)])
+                return false;
+
+        for (int i = 0; i < numValues; i++)
+            dest[i] = slot.values[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        return slot.sequence.load(std::memory_order_relaxed) == sequenceBefore;
+    }
+
+    // Gives up rather than waiting if another thread is writing the slot.
+    void store(const std::array<juce::uint64, numKeyWords>& words, const double* source, int numValues)
+    {
+        auto& slot = getSlot(words);
+        auto sequence = slot.sequence.load(std::memory_order_relaxed);
+
+        if ((sequence & 1) != 0 || !slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed))
+            return;
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (int i = 0; i < numKeyWords; i++)
+            slot.key[static_cast<size_t>(i)].store(words[static_cast<size_t>(i)], std::memory_order_relaxed);
+
+        for (int i = 0; i < numValues; i++)
+            slot.values[static_cast<size_t>(i)].store(source[i], std::memory_order_relaxed);
+
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    template <typename DesignFunction>
+    void getCached(const Key& key, double* values, int numValues, DesignFunction&& design)
+    {
+        auto words = getWords(key);
+
+        if (lookup(words, values, numValues))
+        {
+            numHits.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        numMisses.fetch_add(1, std::memory_order_relaxed);
+
+        design();
+        store(words, values, numValues);
+    }
+
+    void getCachedCut(DesignType type, CutCoefficients& dest, double sampleRate, float frequency, int order,
+                      void (*design)(CutCoefficients&, double, float, int))
+    {
+        jassert(order > 0 && order % 2 == 0 && order / 2 <= static_cast<int>(dest.sections.size()));
+
+        // The sections are contiguous, so they cache as one flat run of values.
+        static_assert(sizeof(dest.sections) == sizeof(double) * maxValues);
+
+        dest.numSections = order / 2;
+
+        getCached(makeKey(type, sampleRate, frequency, 0.f, 0.f, order),
+                  dest.sections[0].data(),
+                  dest.numSections * static_cast<int>(std::tuple_size<CoefficientArray>::value),
+                  [&] { design(dest, sampleRate, frequency, order); });
+    }
+}
+
+CoefficientArray CoefficientCache::getPeakCoefficients(double sampleRate, float frequency, float quality, float gainInDecibels)
+{
+    CoefficientArray coefficients;
+
+    getCached(makeKey(DesignType::Peak, sampleRate, frequency, quality, gainInDecibels, 2),
+              coefficients.data(),
+              static_cast<int>(coefficients.size()),
+              [&] { coefficients = makePeakCoefficients(sampleRate, frequency, quality, gainInDecibels); });
+
+    return coefficients;
+}
+
+void CoefficientCache::getLowCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order)
+{
+    getCachedCut(DesignType::LowCut, dest, sampleRate, frequency, order, makeLowCutCoefficients);
+}
+
+void CoefficientCache::getHighCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order)
+{
+    getCachedCut(DesignType::HighCut, dest, sampleRate, frequency, order, makeHighCutCoefficients);
+}
+
+CoefficientCache::Stats CoefficientCache::getStats()
+{
+    Stats stats;
+
+    stats.hits = numHits.load(std::memory_order_relaxed);
+    stats.misses = numMisses.load(std::memory_order_relaxed);
+
+    return stats;
+}
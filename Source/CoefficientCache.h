@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    CoefficientCache.h
+    Created: 18 Oct 2026 11:03:17pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CoefficientDesign.h"
+
+// A process-wide cache of filter designs keyed by everything they're designed
+// from, so instances running the same settings design each filter once
+// between them instead of once each.
+//
+// It's a fixed table of slots indexed by a hash of the key, each slot a
+// seqlock holding the key and the coefficients. A lookup never waits and
+// never allocates. A slot being written by another thread counts as a miss,
+// and a slot whose key differs is overwritten with the new design. So the
+// memory use is fixed at numSlots entries, and the most recently designed
+// settings win.
+class CoefficientCache
+{
+public:
+    static constexpr int numSlots = 512;
+
+    struct Stats
+    {
+        juce::uint64 hits{ 0 };
+        juce::uint64 misses{ 0 };
+    };
+
+    // Drop-in replacements for the functions in CoefficientDesign.h, safe to
+    // call from any thread including the audio thread.
+    static CoefficientArray getPeakCoefficients(double sampleRate, float frequency, float quality, float gainInDecibels);
+    static void getLowCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order);
+    static void getHighCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order);
+
+    // Lookups since startup, across every instance in the process.
+    static Stats getStats();
+};
@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    CoefficientDesign.cpp
+    Created: 18 Oct 2026 10:12:04am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "CoefficientDesign.h"
+
+namespace
+{
+    // Same section Qs as the even-order branch of FilterDesign's
+    // designIIR*HighOrderButterworthMethod, so the cascades are identical.
+    double getButterworthQuality(int order, int section)
+    {
+        auto angle = (2.0 * section + 1.0) * juce::MathConstants<double>::pi / (order * 2.0);
+        return 1.0 / (2.0 * std::cos(angle));
+    }
+}
+
+CoefficientArray makePeakCoefficients(double sampleRate, float frequency, float quality, float gainInDecibels)
+{
+    return juce::dsp::IIR::ArrayCoefficients<double>::makePeakFilter(sampleRate,
+        static_cast<double>(frequency),
+        static_cast<double>(quality),
+        juce::Decibels::decibelsToGain(static_cast<double>(gainInDecibels)));
+}
+
+void makeLowCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order)
+{
+    jassert(order > 0 && order % 2 == 0);
+    jassert(order / 2 <= static_cast<int>(dest.sections.size()));
+
+    dest.numSections = order / 2;
+
+    for (int i = 0; i < dest.numSections; i++)
+    {
+        dest.sections[i] = juce::dsp::IIR::ArrayCoefficients<double>::makeHighPass(sampleRate,
+            static_cast<double>(frequency),
+            getButterworthQuality(order, i));
+    }
+}
+
+void makeHighCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order)
+{
+    jassert(order > 0 && order % 2 == 0);
+    jassert(order / 2 <= static_cast<int>(dest.sections.size()));
+
+    dest.numSections = order / 2;
+
+    for (int i = 0; i < dest.numSections; i++)
+    {
+        dest.sections[i] = juce::dsp::IIR::ArrayCoefficients<double>::makeLowPass(sampleRate,
+            static_cast<double>(frequency),
+            getButterworthQuality(order, i));
+    }
+}
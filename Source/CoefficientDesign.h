@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    CoefficientDesign.h
+    Created: 18 Oct 2026 10:12:04am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Un-normalised biquad coefficients in the { b0, b1, b2, a0, a1, a2 } layout
+// produced by juce::dsp::IIR::ArrayCoefficients. Designing into these instead of
+// Coefficients::Ptr keeps the audio thread free of allocations. They're always
+// designed in double precision and rounded once by the chain that uses them,
+// so the 64-bit path gets the full accuracy for poles near the unit circle.
+using CoefficientArray = std::array<double, 6>;
+
+struct CutCoefficients
+{
+    std::array<CoefficientArray, 4> sections;
+    int numSections{ 0 };
+};
+
+struct PeakSettings
+{
+    float freq{ 0.f };
+    float gainInDecibels{ 0.f };
+    float quality{ 0.f };
+
+    bool operator==(const PeakSettings& other) const
+    {
+        return freq == other.freq && gainInDecibels == other.gainInDecibels && quality == other.quality;
+    }
+
+    bool operator!=(const PeakSettings& other) const { return !(*this == other); }
+};
+
+struct CutSettings
+{
+    float freq{ 0.f };
+    int gainIndex{ 0 };
+
+    bool operator==(const CutSettings& other) const
+    {
+        return freq == other.freq && gainIndex == other.gainIndex;
+    }
+
+    bool operator!=(const CutSettings& other) const { return !(*this == other); }
+};
+
+// The coefficients a processing chain was last designed with, as published
+// by the audio thread for the response curve. The version goes up with every
+// published change.
+struct CoefficientSnapshot
+{
+    juce::uint64 version{ 0 };
+    double sampleRate{ 0.0 };
+
+    CoefficientArray peak{};
+    CutCoefficients lowCut, highCut;
+
+    bool peakEnabled{ false };
+    bool lowCutEnabled{ false };
+    bool highCutEnabled{ false };
+};
+
+CoefficientArray makePeakCoefficients(double sampleRate, float frequency, float quality, float gainInDecibels);
+
+void makeLowCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order);
+void makeHighCutCoefficients(CutCoefficients& dest, double sampleRate, float frequency, int order);
@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    CutFilterTable.cpp
+    Created: 18 Oct 2026 11:40:27am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "CutFilterTable.h"
+
+namespace
+{
+    // Interpolating between grid points only makes sense with a0 == 1.
+    CoefficientArray normalise(const CoefficientArray& coefficients)
+    {
+        auto a0Inv = 1.0 / coefficients[3];
+
+        return { coefficients[0] * a0Inv,
+                 coefficients[1] * a0Inv,
+                 coefficients[2] * a0Inv,
+                 1.0,
+                 coefficients[4] * a0Inv,
+                 coefficients[5] * a0Inv };
+    }
+}
+
+CutFilterTable::CutFilterTable(double sr)
+    : sampleRate(sr),
+    topFrequency(juce::jmin(maxFrequency, static_cast<float>(sr * 0.49))),
+    logMinFrequency(std::log(minFrequency)),
+    pointsPerLogUnit((numPoints - 1) / (std::log(topFrequency) - logMinFrequency))
+{
+    jassert(sampleRate > 0);
+
+    build(lowCut, makeLowCutCoefficients);
+    build(highCut, makeHighCutCoefficients);
+}
+
+std::shared_ptr<const CutFilterTable> CutFilterTable::getForSampleRate(double sampleRate)
+{
+    static juce::CriticalSection lock;
+    static std::map<double, std::weak_ptr<const CutFilterTable>> tables;
+
+    const juce::ScopedLock sl(lock);
+
+    auto& entry = tables[sampleRate];
+
+    if (auto table = entry.lock())
+        return table;
+
+    auto table = std::make_shared<const CutFilterTable>(sampleRate);
+    entry = table;
+
+    return table;
+}
+
+void CutFilterTable::getLowCutCoefficients(CutCoefficients& dest, float frequency, int gainIndex) const
+{
+    lookup(lowCut, dest, frequency, gainIndex);
+}
+
+void CutFilterTable::getHighCutCoefficients(CutCoefficients& dest, float frequency, int gainIndex) const
+{
+    lookup(highCut, dest, frequency, gainIndex);
+}
+
+void CutFilterTable::build(Table& table, void (*design)(CutCoefficients&, double, float, int))
+{
+    CutCoefficients coefficients;
+
+    for (int gainIndex = 0; gainIndex < numSlopes; gainIndex++)
+    {
+        auto numSections = gainIndex + 1;
+        auto& points = table[gainIndex];
+
+        points.resize(numPoints * numSections);
+
+        for (int i = 0; i < numPoints; i++)
+        {
+            auto frequency = std::exp(logMinFrequency + i / pointsPerLogUnit);
+            design(coefficients, sampleRate, juce::jmin(frequency, topFrequency), numSections * 2);
+
+            for (int section = 0; section < numSections; section++)
+            {
+                points[i * numSections + section] = normalise(coefficients.sections[section]);
+            }
+        }
+    }
+}
+
+void CutFilterTable::lookup(const Table& table, CutCoefficients& dest, float frequency, int gainIndex) const
+{
+    jassert(gainIndex >= 0 && gainIndex < numSlopes);
+
+    auto numSections = gainIndex + 1;
+    auto& points = table[gainIndex];
+
+    auto position = (std::log(juce::jlimit(minFrequency, topFrequency, frequency)) - logMinFrequency) * pointsPerLogUnit;
+    auto index = juce::jlimit(0, numPoints - 2, static_cast<int>(position));
+    auto fraction = static_cast<double>(position - index);
+
+    dest.numSections = numSections;
+
+    for (int section = 0; section < numSections; section++)
+    {
+        auto& lower = points[index * numSections + section];
+        auto& upper = points[(index + 1) * numSections + section];
+
+        for (size_t i = 0; i < lower.size(); i++)
+        {
+            dest.sections[section][i] = lower[i] + fraction * (upper[i] - lower[i]);
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    CutFilterTable.h
+    Created: 18 Oct 2026 11:40:27am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CoefficientDesign.h"
+
+// Low cut and high cut Butterworth cascades for every slope choice, designed
+// up front on a log-spaced frequency grid for one sample rate. A cutoff change
+// then costs a lookup and a linear interpolation instead of a redesign.
+class CutFilterTable
+{
+public:
+    static constexpr int numSlopes = 4;
+    static constexpr int numPoints = 2048;
+    static constexpr float minFrequency = 20.f;
+    static constexpr float maxFrequency = 20000.f;
+
+    explicit CutFilterTable(double sampleRate);
+
+    // Tables are immutable once built, so every instance running at the same
+    // sample rate shares one. Call from prepareToPlay, never the audio thread.
+    static std::shared_ptr<const CutFilterTable> getForSampleRate(double sampleRate);
+
+    double getSampleRate() const { return sampleRate; }
+
+    void getLowCutCoefficients(CutCoefficients& dest, float frequency, int gainIndex) const;
+    void getHighCutCoefficients(CutCoefficients& dest, float frequency, int gainIndex) const;
+
+private:
+    using Table = std::array<std::vector<CoefficientArray>, numSlopes>;
+
+    void build(Table& table, void (*design)(CutCoefficients&, double, float, int));
+    void lookup(const Table& table, CutCoefficients& dest, float frequency, int gainIndex) const;
+
+    double sampleRate;
+    float topFrequency;
+    float logMinFrequency, pointsPerLogUnit;
+
+    Table lowCut, highCut;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CutFilterTable)
+};
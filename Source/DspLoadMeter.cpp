@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    DspLoadMeter.cpp
+    Created: 18 Oct 2026 9:47:31pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "DspLoadMeter.h"
+
+#if SIMPLEEQ_DSP_LOAD_METER
+
+void DspLoadMeter::prepare(double sampleRate)
+{
+    ticksPerSample = static_cast<double>(juce::Time::getHighResolutionTicksPerSecond()) / sampleRate;
+    pendingRecomputes = 0;
+
+    for (auto& entry : history)
+        entry.store(0, std::memory_order_relaxed);
+
+    numBlocksWritten.store(0, std::memory_order_release);
+
+    for (auto* total : { &totalBlocks, &totalNearBudget, &totalOverBudget, &totalRecomputes })
+        total->store(0, std::memory_order_relaxed);
+}
+
+void DspLoadMeter::addBlock(double load) noexcept
+{
+    auto loadBits = juce::uint32{};
+    auto loadAsFloat = static_cast<float>(load);
+    std::memcpy(&loadBits, &loadAsFloat, sizeof(loadBits));
+
+    auto entry = (static_cast<juce::uint64>(loadBits) << 32) | static_cast<juce::uint32>(pendingRecomputes);
+
+    auto increment = [](std::atomic<juce::uint64>& total, juce::uint64 amount)
+    {
+        total.store(total.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    };
+
+    increment(totalBlocks, 1);
+    increment(totalRecomputes, static_cast<juce::uint64>(pendingRecomputes));
+
+    if (load > 1.0)
+        increment(totalOverBudget, 1);
+    else if (load > nearBudgetLoad)
+        increment(totalNearBudget, 1);
+
+    pendingRecomputes = 0;
+
+    auto index = numBlocksWritten.load(std::memory_order_relaxed);
+    history[index % historySize].store(entry, std::memory_order_relaxed);
+    numBlocksWritten.store(index + 1, std::memory_order_release);
+}
+
+DspLoadMeter::Reading DspLoadMeter::getReading(int maxBlocks) const
+{
+    Reading reading;
+
+    auto numWritten = numBlocksWritten.load(std::memory_order_acquire);
+    reading.numBlocks = static_cast<int>(juce::jmin(static_cast<juce::uint32>(juce::jlimit(0, historySize, maxBlocks)), numWritten));
+
+    if (reading.numBlocks == 0)
+        return reading;
+
+    auto totalLoad = 0.0;
+
+    for (int i = 1; i <= reading.numBlocks; i++)
+    {
+        auto entry = history[(numWritten - static_cast<juce::uint32>(i)) % historySize].load(std::memory_order_relaxed);
+
+        auto loadBits = static_cast<juce::uint32>(entry >> 32);
+        float load;
+        std::memcpy(&load, &loadBits, sizeof(load));
+
+        totalLoad += load;
+        reading.peakLoad = juce::jmax(reading.peakLoad, load);
+        reading.numRecomputes += static_cast<int>(entry & 0xffffffff);
+    }
+
+    reading.averageLoad = static_cast<float>(totalLoad / reading.numBlocks);
+
+    return reading;
+}
+
+DspLoadMeter::Totals DspLoadMeter::getTotals() const
+{
+    Totals totals;
+
+    totals.numBlocks = totalBlocks.load(std::memory_order_relaxed);
+    totals.numNearBudget = totalNearBudget.load(std::memory_order_relaxed);
+    totals.numOverBudget = totalOverBudget.load(std::memory_order_relaxed);
+    totals.numRecomputes = totalRecomputes.load(std::memory_order_relaxed);
+
+    return totals;
+}
+
+#else
+
+void DspLoadMeter::prepare(double)
+{
+}
+
+DspLoadMeter::Reading DspLoadMeter::getReading(int) const
+{
+    return {};
+}
+
+DspLoadMeter::Totals DspLoadMeter::getTotals() const
+{
+    return {};
+}
+
+#endif
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    DspLoadMeter.h
+    Created: 18 Oct 2026 9:47:31pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef SIMPLEEQ_DSP_LOAD_METER
+ #define SIMPLEEQ_DSP_LOAD_METER 1
+#endif
+
+// How much of its real time budget one instance is using. processBlock times
+// itself into a ring of the most recent blocks, each entry holding the
+// fraction of that block's duration spent processing it and the number of
+// coefficient redesigns it did. The audio thread only ever stores to the ring,
+// and readers on any other thread never wait on it.
+//
+// Set SIMPLEEQ_DSP_LOAD_METER to 0 for a lean build: nothing is timed and
+// every reading comes back empty.
+class DspLoadMeter
+{
+public:
+    static constexpr int historySize = 256;
+
+    // Blocks over this share of their budget count as at risk of an xrun.
+    static constexpr float nearBudgetLoad = 0.8f;
+
+    struct Reading
+    {
+        int numBlocks{ 0 };
+        float averageLoad{ 0.f };
+        float peakLoad{ 0.f };
+        int numRecomputes{ 0 };
+    };
+
+    // Counts since the last prepare, never reset by the history wrapping.
+    struct Totals
+    {
+        juce::uint64 numBlocks{ 0 };
+        juce::uint64 numNearBudget{ 0 };
+        juce::uint64 numOverBudget{ 0 };
+        juce::uint64 numRecomputes{ 0 };
+    };
+
+    // Call from prepareToPlay with the host rate. Clears the history and totals.
+    void prepare(double sampleRate);
+
+    // Audio thread only, between the start and end of a block.
+    void addRecompute() noexcept
+    {
+       #if SIMPLEEQ_DSP_LOAD_METER
+        pendingRecomputes++;
+       #endif
+    }
+
+    // Any thread. Covers the last maxBlocks blocks at most; an entry can be
+    // overwritten by a newer block while it's being read, but never torn.
+    Reading getReading(int maxBlocks = historySize) const;
+
+    // Any thread. Each count is exact, though they may be a block apart.
+    Totals getTotals() const;
+
+    // Times one processBlock call.
+    class ScopedBlock
+    {
+    public:
+       #if SIMPLEEQ_DSP_LOAD_METER
+        ScopedBlock(DspLoadMeter& m, int numSamples) noexcept
+            : meter(m), budgetTicks(numSamples * m.ticksPerSample), startTicks(juce::Time::getHighResolutionTicks())
+        {
+        }
+
+        ~ScopedBlock() noexcept
+        {
+            // An empty block has no budget to measure against, and would
+            // only put an infinite or NaN load into the history.
+            if (budgetTicks > 0.0)
+                meter.addBlock(static_cast<double>(juce::Time::getHighResolutionTicks() - startTicks) / budgetTicks);
+        }
+       #else
+        ScopedBlock(DspLoadMeter&, int) noexcept {}
+       #endif
+
+    private:
+       #if SIMPLEEQ_DSP_LOAD_METER
+        DspLoadMeter& meter;
+        const double budgetTicks;
+        const juce::int64 startTicks;
+       #endif
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedBlock)
+    };
+
+private:
+   #if SIMPLEEQ_DSP_LOAD_METER
+    void addBlock(double load) noexcept;
+
+    double ticksPerSample{ 0.0 };
+    int pendingRecomputes{ 0 };
+
+    // Each entry packs the load as float bits above the recompute count, so
+    // it can be stored and loaded in one go.
+    std::array<std::atomic<juce::uint64>, historySize> history{};
+    std::atomic<juce::uint32> numBlocksWritten{ 0 };
+
+    // Only the audio thread writes these, so they're bumped with a plain
+    // load and store rather than a read-modify-write.
+    std::atomic<juce::uint64> totalBlocks{ 0 }, totalNearBudget{ 0 }, totalOverBudget{ 0 }, totalRecomputes{ 0 };
+   #endif
+};
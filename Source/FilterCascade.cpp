@@ -0,0 +1,294 @@
+/*
+  ==============================================================================
+
+    FilterCascade.cpp
+    Created: 18 Oct 2026 4:02:45pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "FilterCascade.h"
+
+namespace
+{
+    // (p, k) becomes (p q, k q + p l), where k and l are z^-1 times the
+    // derivatives of p and q: the product rule, in real and imaginary parts.
+    template <typename Vector>
+    void multiplyPolynomials(Vector& pr, Vector& pi, Vector& kr, Vector& ki, Vector qr, Vector qi, Vector lr, Vector li)
+    {
+        auto productKr = kr * qr - ki * qi + pr * lr - pi * li;
+        auto productKi = kr * qi + ki * qr + pr * li + pi * lr;
+        auto productPr = pr * qr - pi * qi;
+
+        pi = pr * qi + pi * qr;
+        pr = productPr;
+        kr = productKr;
+        ki = productKi;
+    }
+
+    // The group delay of a polynomial in z^-1 is Re(k / p), with k as above.
+    double getGroupDelay(std::complex<double> p, std::complex<double> k)
+    {
+        auto norm = std::norm(p);
+        return norm > 0.0 ? (k * std::conj(p)).real() / norm : 0.0;
+    }
+}
+
+void ResponseGrid::setFrequencies(const double* frequencies, int newNumPoints, double sampleRate)
+{
+    numPoints = newNumPoints;
+
+    // Padding lanes sit at z^-1 = 1, DC, and are never read back.
+    auto numVectors = static_cast<size_t>((numPoints + numLanes - 1) / numLanes);
+    reals.assign(numVectors, broadcast(1.0));
+    imaginaries.assign(numVectors, broadcast(0.0));
+
+    auto* rawReals = reinterpret_cast<double*>(reals.data());
+    auto* rawImaginaries = reinterpret_cast<double*>(imaginaries.data());
+
+    for (int i = 0; i < numPoints; i++)
+    {
+        auto w = juce::MathConstants<double>::twoPi * frequencies[i] / sampleRate;
+
+        rawReals[i] = std::cos(w);
+        rawImaginaries[i] = -std::sin(w);
+    }
+}
+
+template <typename SampleType>
+BiquadCoefficients<SampleType> BiquadCoefficients<SampleType>::fromArray(const CoefficientArray& coefficients)
+{
+    auto a0Inv = 1.0 / coefficients[3];
+
+    BiquadCoefficients section;
+    section.b0 = static_cast<SampleType>(coefficients[0] * a0Inv);
+    section.b1 = static_cast<SampleType>(coefficients[1] * a0Inv);
+    section.b2 = static_cast<SampleType>(coefficients[2] * a0Inv);
+    section.a1 = static_cast<SampleType>(coefficients[4] * a0Inv);
+    section.a2 = static_cast<SampleType>(coefficients[5] * a0Inv);
+
+    return section;
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::setLowCutCoefficients(const CutCoefficients& coefficients)
+{
+    jassert(coefficients.numSections <= maxCutSections);
+
+    for (int i = 0; i < coefficients.numSections; i++)
+        lowCut[i] = Coefficients::fromArray(coefficients.sections[i]);
+
+    numLowCutSections = coefficients.numSections;
+    updateLayout();
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::setPeakCoefficients(const CoefficientArray& coefficients)
+{
+    peak = Coefficients::fromArray(coefficients);
+
+    if (layout.numPeakSections > 0)
+        sections[layout.getPeakIndex()] = peak;
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::setHighCutCoefficients(const CutCoefficients& coefficients)
+{
+    jassert(coefficients.numSections <= maxCutSections);
+
+    for (int i = 0; i < coefficients.numSections; i++)
+        highCut[i] = Coefficients::fromArray(coefficients.sections[i]);
+
+    numHighCutSections = coefficients.numSections;
+    updateLayout();
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::setStageEnabled(Stage stage, bool shouldBeEnabled)
+{
+    stageEnabled[stage] = shouldBeEnabled;
+    updateLayout();
+}
+
+template <typename SampleType>
+double FilterCascade<SampleType>::getMagnitudeForFrequency(double frequency, double sampleRate) const
+{
+    constexpr std::complex<double> j(0, 1);
+
+    auto jw = std::exp(-juce::MathConstants<double>::twoPi * frequency * j / sampleRate);
+    auto jw2 = jw * jw;
+
+    double magnitude = 1.0;
+
+    for (int i = 0; i < getNumSections(); i++)
+    {
+        auto& c = sections[i];
+
+        auto numerator = static_cast<double>(c.b0) + static_cast<double>(c.b1) * jw + static_cast<double>(c.b2) * jw2;
+        auto denominator = 1.0 + static_cast<double>(c.a1) * jw + static_cast<double>(c.a2) * jw2;
+
+        magnitude *= std::abs(numerator / denominator);
+    }
+
+    return magnitude;
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::getFrequencyResponse(const ResponseGrid& grid, const FrequencyResponse& response) const
+{
+    getSectionsResponse(0, getNumSections(), grid, response);
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::getFrequencyResponse(Stage stage, const ResponseGrid& grid, const FrequencyResponse& response) const
+{
+    auto firstSection = layout.getFirstSection(stage);
+    getSectionsResponse(firstSection, firstSection + layout.getNumSections(stage), grid, response);
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::getSectionsResponse(int firstSection, int endSection, const ResponseGrid& grid, const FrequencyResponse& response) const
+{
+    using Vector = ResponseGrid::Vector;
+
+    for (int v = 0; v < grid.getNumVectors(); v++)
+    {
+        auto z1r = grid.getReals()[v];
+        auto z1i = grid.getImaginaries()[v];
+        auto z2r = z1r * z1r - z1i * z1i;
+        auto z2i = z1r * z1i * 2.0;
+
+        // The numerator and denominator of the whole run of sections, each a
+        // product of polynomials in z^-1, along with z^-1 times their
+        // derivative, which is all the group delay needs. Only multiplies and
+        // adds, so every lane goes through together.
+        auto nr = ResponseGrid::broadcast(1.0), ni = ResponseGrid::broadcast(0.0);
+        auto dr = nr, di = ni, nkr = ni, nki = ni, dkr = ni, dki = ni;
+
+        for (int i = firstSection; i < endSection; i++)
+        {
+            auto& c = sections[i];
+            auto b1 = static_cast<double>(c.b1), b2 = static_cast<double>(c.b2);
+            auto a1 = static_cast<double>(c.a1), a2 = static_cast<double>(c.a2);
+
+            multiplyPolynomials(nr, ni, nkr, nki,
+                                z1r * b1 + z2r * b2 + static_cast<double>(c.b0), z1i * b1 + z2i * b2,
+                                z1r * b1 + z2r * (b2 * 2.0), z1i * b1 + z2i * (b2 * 2.0));
+
+            multiplyPolynomials(dr, di, dkr, dki,
+                                z1r * a1 + z2r * a2 + 1.0, z1i * a1 + z2i * a2,
+                                z1r * a1 + z2r * (a2 * 2.0), z1i * a1 + z2i * (a2 * 2.0));
+        }
+
+        auto lane = [](const Vector& vector, int index) { return reinterpret_cast<const double*>(&vector)[index]; };
+
+        for (int l = 0; l < ResponseGrid::numLanes; l++)
+        {
+            auto point = v * ResponseGrid::numLanes + l;
+
+            if (point >= grid.getNumPoints())
+                break;
+
+            std::complex<double> numerator(lane(nr, l), lane(ni, l));
+            std::complex<double> denominator(lane(dr, l), lane(di, l));
+
+            if (response.magnitudes != nullptr)
+                response.magnitudes[point] = std::abs(numerator) / std::abs(denominator);
+
+            if (response.phases != nullptr)
+                response.phases[point] = std::arg(numerator * std::conj(denominator));
+
+            if (response.groupDelays != nullptr)
+            {
+                response.groupDelays[point] = getGroupDelay(numerator, { lane(nkr, l), lane(nki, l) })
+                                            - getGroupDelay(denominator, { lane(dkr, l), lane(dki, l) });
+            }
+        }
+    }
+}
+
+template <typename SampleType>
+double FilterCascade<SampleType>::getDecayTimeSamples(double decayGain) const
+{
+    double slowestRadius = 0.0;
+
+    for (int i = 0; i < getNumSections(); i++)
+    {
+        auto a1 = static_cast<double>(sections[i].a1);
+        auto a2 = static_cast<double>(sections[i].a2);
+
+        // Poles are the roots of z^2 + a1 z + a2.
+        auto discriminant = a1 * a1 - 4.0 * a2;
+        double radius;
+
+        if (discriminant < 0.0)
+        {
+            radius = std::sqrt(a2);
+        }
+        else
+        {
+            auto root = std::sqrt(discriminant);
+            radius = 0.5 * juce::jmax(std::abs(-a1 + root), std::abs(-a1 - root));
+        }
+
+        slowestRadius = juce::jmax(slowestRadius, radius);
+    }
+
+    if (slowestRadius <= 0.0)
+        return 0.0;
+
+    if (slowestRadius >= 1.0)
+        return std::numeric_limits<double>::infinity();
+
+    return std::log(decayGain) / std::log(slowestRadius);
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.numChannels == 1);
+    reset();
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::reset()
+{
+    state1.fill(0);
+    state2.fill(0);
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::process(const juce::dsp::ProcessContextReplacing<SampleType>& context)
+{
+    auto& block = context.getOutputBlock();
+    jassert(block.getNumChannels() == 1);
+
+    processSections(block.getChannelPointer(0), block.getNumSamples(), state1.data(), state2.data());
+}
+
+template <typename SampleType>
+void FilterCascade<SampleType>::updateLayout()
+{
+    Layout newLayout{ stageEnabled[LowCut] ? numLowCutSections : 0,
+                      stageEnabled[Peak] ? 1 : 0,
+                      stageEnabled[HighCut] ? numHighCutSections : 0 };
+
+    if (newLayout != layout)
+    {
+        relayoutState(state1, layout, newLayout, SampleType(0));
+        relayoutState(state2, layout, newLayout, SampleType(0));
+        layout = newLayout;
+    }
+
+    std::copy(lowCut.begin(), lowCut.begin() + layout.numLowCutSections, sections.begin());
+
+    if (layout.numPeakSections > 0)
+        sections[layout.getPeakIndex()] = peak;
+    std::copy(highCut.begin(), highCut.begin() + layout.numHighCutSections, sections.begin() + layout.getHighCutIndex());
+}
+
+template struct BiquadCoefficients<float>;
+template struct BiquadCoefficients<double>;
+template class FilterCascade<float>;
+template class FilterCascade<double>;
@@ -0,0 +1,252 @@
+/*
+  ==============================================================================
+
+    FilterCascade.h
+    Created: 18 Oct 2026 4:02:45pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CoefficientDesign.h"
+
+// Normalised the way IIR::Coefficients does it, { b0, b1, b2, a1, a2 }.
+template <typename SampleType>
+struct BiquadCoefficients
+{
+    SampleType b0{ 1 }, b1{ 0 }, b2{ 0 }, a1{ 0 }, a2{ 0 };
+
+    static BiquadCoefficients fromArray(const CoefficientArray& coefficients);
+
+    bool operator==(const BiquadCoefficients& other) const
+    {
+        return b0 == other.b0 && b1 == other.b1 && b2 == other.b2 && a1 == other.a1 && a2 == other.a2;
+    }
+
+    bool operator!=(const BiquadCoefficients& other) const { return !(*this == other); }
+};
+
+// Frequencies to evaluate a FilterCascade's response at, held as the points
+// z^-1 = exp(-jw) on the unit circle. The real and imaginary parts are packed
+// a point per SIMD lane, with the last register padded out, so a whole grid
+// goes through the sections in one vectorised pass.
+class ResponseGrid
+{
+public:
+   #if JUCE_USE_SIMD
+    using Vector = juce::dsp::SIMDRegister<double>;
+
+    static Vector broadcast(double value) { return Vector::expand(value); }
+   #else
+    using Vector = double;
+
+    static Vector broadcast(double value) { return value; }
+   #endif
+
+    static constexpr int numLanes = static_cast<int>(sizeof(Vector) / sizeof(double));
+
+    // Frequencies in Hz, for a cascade designed at sampleRate.
+    void setFrequencies(const double* frequencies, int numPoints, double sampleRate);
+
+    int getNumPoints() const { return numPoints; }
+    int getNumVectors() const { return static_cast<int>(reals.size()); }
+
+    const Vector* getReals() const { return reals.data(); }
+    const Vector* getImaginaries() const { return imaginaries.data(); }
+
+private:
+    std::vector<Vector> reals, imaginaries;
+    int numPoints{ 0 };
+};
+
+// Where FilterCascade::getFrequencyResponse writes, a value per grid point.
+// Anything that isn't wanted can be left null.
+struct FrequencyResponse
+{
+    double* magnitudes{ nullptr };   // linear gain
+    double* phases{ nullptr };       // radians, in [-pi, pi]
+    double* groupDelays{ nullptr };  // samples at the grid's sample rate
+};
+
+// The bands of the chain, in processing order.
+enum CascadeStage
+{
+    LowCut,
+    Peak,
+    HighCut
+};
+
+// The low cut -> peak -> high cut chain as plain data: the coefficients of the
+// active sections are packed contiguously in processing order and the layout
+// says how many there are, so running the chain is a single loop over
+// sections with no per-stage bypass checks or reference-counted coefficient
+// objects. Used directly as the mono chain, as the coefficient
+// set of SIMDFilterChain and by ResponseCurveComponent.
+//
+// A stage that is switched off (e.g. a cut sitting at the edge of its range)
+// keeps its coefficients but is left out of the packed sections entirely.
+//
+// SampleType is float or double; the 64-bit version keeps its coefficients
+// and state in double too.
+template <typename SampleType>
+class FilterCascade
+{
+public:
+    using Coefficients = BiquadCoefficients<SampleType>;
+
+    static constexpr int maxCutSections = 4;
+    static constexpr int maxSections = maxCutSections * 2 + 1;
+
+    using Stage = CascadeStage;
+    static constexpr int numStages = 3;
+
+    struct Layout
+    {
+        int numLowCutSections{ 0 };
+        int numPeakSections{ 1 };
+        int numHighCutSections{ 0 };
+
+        int getPeakIndex() const { return numLowCutSections; }
+        int getHighCutIndex() const { return numLowCutSections + numPeakSections; }
+        int getNumSections() const { return numLowCutSections + numPeakSections + numHighCutSections; }
+
+        int getFirstSection(Stage stage) const
+        {
+            return stage == LowCut ? 0 : stage == Peak ? getPeakIndex() : getHighCutIndex();
+        }
+
+        int getNumSections(Stage stage) const
+        {
+            return stage == LowCut ? numLowCutSections : stage == Peak ? numPeakSections : numHighCutSections;
+        }
+
+        bool operator==(const Layout& other) const
+        {
+            return numLowCutSections == other.numLowCutSections
+                && numPeakSections == other.numPeakSections
+                && numHighCutSections == other.numHighCutSections;
+        }
+
+        bool operator!=(const Layout& other) const { return !(*this == other); }
+    };
+
+    void setLowCutCoefficients(const CutCoefficients& coefficients);
+    void setPeakCoefficients(const CoefficientArray& coefficients);
+    void setHighCutCoefficients(const CutCoefficients& coefficients);
+
+    // Every stage starts out enabled.
+    void setStageEnabled(Stage stage, bool shouldBeEnabled);
+    bool isStageEnabled(Stage stage) const { return stageEnabled[stage]; }
+
+    const Layout& getLayout() const { return layout; }
+    int getNumSections() const { return layout.getNumSections(); }
+    const Coefficients* getSections() const { return sections.data(); }
+
+    double getMagnitudeForFrequency(double frequency, double sampleRate) const;
+
+    // The response of all the active sections together at every point of the
+    // grid, or of one stage's sections alone. A stage that is switched off
+    // comes out flat. For offline checks as much as for drawing.
+    void getFrequencyResponse(const ResponseGrid& grid, const FrequencyResponse& response) const;
+    void getFrequencyResponse(Stage stage, const ResponseGrid& grid, const FrequencyResponse& response) const;
+
+    // How long the impulse response of the active sections takes to decay by
+    // decayGain (e.g. 1.0e-6 for 120 dB), going by the pole closest to the
+    // unit circle.
+    double getDecayTimeSamples(double decayGain) const;
+
+    // Mono processing, so the cascade can stand in for a ProcessorChain.
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+    void process(const juce::dsp::ProcessContextReplacing<SampleType>& context);
+
+    // Runs every active section over the block, one section at a time, with
+    // the same arithmetic and end-of-block snap-to-zero as IIR::Filter.
+    // VectorType is SampleType, or a SIMDRegister carrying one channel per lane.
+    template <typename VectorType>
+    void processSections(VectorType* samples, size_t numSamples, VectorType* state1, VectorType* state2) const
+    {
+        processSections(samples, numSamples, state1, state2, 0, getNumSections());
+    }
+
+    // The same, for the sections in [firstSection, endSection) only.
+    template <typename VectorType>
+    void processSections(VectorType* samples, size_t numSamples, VectorType* state1, VectorType* state2,
+                         int firstSection, int endSection) const
+    {
+        for (int section = firstSection; section < endSection; section++)
+        {
+            auto& c = sections[section];
+            auto lv1 = state1[section];
+            auto lv2 = state2[section];
+
+            for (size_t i = 0; i < numSamples; i++)
+            {
+                auto input = samples[i];
+                auto output = (input * c.b0) + lv1;
+                samples[i] = output;
+
+                lv1 = (input * c.b1) - (output * c.a1) + lv2;
+                lv2 = (input * c.b2) - (output * c.a2);
+            }
+
+            snapToZero(lv1);
+            snapToZero(lv2);
+
+            state1[section] = lv1;
+            state2[section] = lv2;
+        }
+    }
+
+    // Moves per-section state to where those sections sit after a slope
+    // change or a stage being switched on or off; sections that are new to
+    // the cascade start from zero.
+    template <typename StateType>
+    static void relayoutState(std::array<StateType, maxSections>& state, const Layout& from, const Layout& to, StateType zero)
+    {
+        auto old = state;
+
+        for (int i = 0; i < to.numLowCutSections; i++)
+            state[i] = i < from.numLowCutSections ? old[i] : zero;
+
+        if (to.numPeakSections > 0)
+            state[to.getPeakIndex()] = from.numPeakSections > 0 ? old[from.getPeakIndex()] : zero;
+
+        for (int i = 0; i < to.numHighCutSections; i++)
+            state[to.getHighCutIndex() + i] = i < from.numHighCutSections ? old[from.getHighCutIndex() + i] : zero;
+    }
+
+private:
+    static void snapToZero(SampleType& value) { juce::dsp::util::snapToZero(value); }
+
+   #if JUCE_USE_SIMD
+    static void snapToZero(juce::dsp::SIMDRegister<SampleType>& value)
+    {
+        for (size_t lane = 0; lane < juce::dsp::SIMDRegister<SampleType>::SIMDNumElements; lane++)
+        {
+            auto element = value.get(lane);
+            juce::dsp::util::snapToZero(element);
+            value.set(lane, element);
+        }
+    }
+   #endif
+
+    void updateLayout();
+
+    void getSectionsResponse(int firstSection, int endSection, const ResponseGrid& grid, const FrequencyResponse& response) const;
+
+    // Per band, so a slope change can repack the active sections.
+    std::array<Coefficients, maxCutSections> lowCut, highCut;
+    Coefficients peak;
+
+    int numLowCutSections{ 0 }, numHighCutSections{ 0 };
+    std::array<bool, numStages> stageEnabled{ true, true, true };
+
+    Layout layout;
+    std::array<Coefficients, maxSections> sections;
+
+    std::array<SampleType, maxSections> state1{}, state2{};
+};
@@ -0,0 +1,214 @@
+/*
+  ==============================================================================
+
+    LinearPhaseFilter.cpp
+    Created: 18 Oct 2026 6:14:37pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "LinearPhaseFilter.h"
+
+LinearPhaseFilter::LinearPhaseFilter(DesignFunction designFunction)
+    : juce::Thread("Linear phase kernel design"),
+    design(std::move(designFunction))
+{
+}
+
+LinearPhaseFilter::~LinearPhaseFilter()
+{
+    deactivate();
+}
+
+void LinearPhaseFilter::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    deactivate();
+
+    processSpec = spec;
+    kernelSize = juce::nextPowerOfTwo(juce::roundToInt(spec.sampleRate * kernelLengthSeconds));
+}
+
+void LinearPhaseFilter::activate()
+{
+    // Starts over from nothing, so a second call rebuilds for the current spec.
+    deactivate();
+
+    messageQueue = std::make_unique<juce::dsp::ConvolutionMessageQueue>();
+
+    auto numPairs = (processSpec.numChannels + 1) / 2;
+
+    for (juce::uint32 pair = 0; pair < numPairs; pair++)
+        convolutions.push_back(std::make_unique<juce::dsp::Convolution>(juce::dsp::Convolution::Latency{ 0 }, *messageQueue));
+
+    // Loaded before the convolutions are prepared, so the very first block
+    // runs it instead of crossfading to it whenever the message queue gets
+    // round to it. That also keeps offline renders repeatable.
+    rebuildNeeded.store(false);
+    loadKernel(designKernel());
+    prepareConvolutions();
+
+    conversionBuffer.setSize(static_cast<int>(processSpec.numChannels), static_cast<int>(processSpec.maximumBlockSize));
+
+    active = true;
+    startThread();
+}
+
+void LinearPhaseFilter::deactivate()
+{
+    // The design thread touches the engines, so it has to be out of the way.
+    stopThread(1000);
+
+    // The engines use the queue, so they go first.
+    convolutions.clear();
+    messageQueue.reset();
+    conversionBuffer.setSize(0, 0);
+
+    active = false;
+}
+
+void LinearPhaseFilter::reset()
+{
+    for (auto& convolution : convolutions)
+        convolution->reset();
+}
+
+void LinearPhaseFilter::triggerRebuild()
+{
+    rebuildNeeded.store(true);
+}
+
+void LinearPhaseFilter::prepareConvolutions()
+{
+    for (size_t pair = 0; pair < convolutions.size(); pair++)
+    {
+        auto numChannels = juce::jmin(2u, processSpec.numChannels - static_cast<juce::uint32>(pair) * 2);
+        convolutions[pair]->prepare({ processSpec.sampleRate, processSpec.maximumBlockSize, numChannels });
+    }
+}
+
+void LinearPhaseFilter::process(const juce::dsp::ProcessContextReplacing<float>& context)
+{
+    auto& block = context.getOutputBlock();
+    auto numChannels = block.getNumChannels();
+
+    for (size_t pair = 0; pair < convolutions.size() && pair * 2 < numChannels; pair++)
+    {
+        auto pairBlock = block.getSubsetChannelBlock(pair * 2, juce::jmin(static_cast<size_t>(2), numChannels - pair * 2));
+        convolutions[pair]->process(juce::dsp::ProcessContextReplacing<float>(pairBlock));
+    }
+}
+
+void LinearPhaseFilter::process(const juce::dsp::ProcessContextReplacing<double>& context)
+{
+    auto& block = context.getOutputBlock();
+
+    auto numChannels = juce::jmin(block.getNumChannels(), static_cast<size_t>(conversionBuffer.getNumChannels()));
+    auto numSamples = block.getNumSamples();
+    auto chunkSize = static_cast<size_t>(conversionBuffer.getNumSamples());
+
+    // Nothing to convert into before prepare.
+    if (chunkSize == 0)
+        return;
+
+    // The scratch buffer only holds the prepared block size, and some hosts
+    // send more than they announced.
+    for (size_t start = 0; start < numSamples; start += chunkSize)
+    {
+        auto numInChunk = juce::jmin(chunkSize, numSamples - start);
+
+        for (size_t channel = 0; channel < numChannels; channel++)
+        {
+            auto* source = block.getChannelPointer(channel) + start;
+            auto* dest = conversionBuffer.getWritePointer(static_cast<int>(channel));
+
+            for (size_t i = 0; i < numInChunk; i++)
+                dest[i] = static_cast<float>(source[i]);
+        }
+
+        auto floatBlock = juce::dsp::AudioBlock<float>(conversionBuffer).getSubsetChannelBlock(0, numChannels).getSubBlock(0, numInChunk);
+        process(juce::dsp::ProcessContextReplacing<float>(floatBlock));
+
+        for (size_t channel = 0; channel < numChannels; channel++)
+        {
+            auto* source = conversionBuffer.getReadPointer(static_cast<int>(channel));
+            auto* dest = block.getChannelPointer(channel) + start;
+
+            for (size_t i = 0; i < numInChunk; i++)
+                dest[i] = static_cast<double>(source[i]);
+        }
+    }
+}
+
+void LinearPhaseFilter::run()
+{
+    while (!threadShouldExit())
+    {
+        // Changes that land while a kernel is being built are picked up by
+        // the next pass rather than lost.
+        if (rebuildNeeded.exchange(false))
+            loadKernel(designKernel());
+
+        // Polled rather than notified, as triggerRebuild is called from the
+        // audio thread and notify() takes a lock. The thread only runs while
+        // linear phase is on.
+        wait(pollIntervalMs);
+    }
+}
+
+juce::AudioBuffer<float> LinearPhaseFilter::designKernel()
+{
+    FilterCascade<float> cascade;
+    auto designSampleRate = design(cascade);
+
+    auto fftOrder = juce::roundToInt(std::log2(kernelSize));
+    juce::dsp::FFT fft(fftOrder);
+
+    // A real, zero phase spectrum up to Nyquist, in the interleaved layout
+    // performRealOnlyInverseTransform expects.
+    std::vector<float> spectrum(static_cast<size_t>(kernelSize) * 2, 0.f);
+
+    auto numBins = kernelSize / 2 + 1;
+    std::vector<double> frequencies(static_cast<size_t>(numBins)), magnitudes(static_cast<size_t>(numBins));
+
+    for (int bin = 0; bin < numBins; bin++)
+        frequencies[static_cast<size_t>(bin)] = bin * processSpec.sampleRate / kernelSize;
+
+    ResponseGrid grid;
+    grid.setFrequencies(frequencies.data(), numBins, designSampleRate);
+
+    FrequencyResponse response;
+    response.magnitudes = magnitudes.data();
+    cascade.getFrequencyResponse(grid, response);
+
+    for (int bin = 0; bin < numBins; bin++)
+        spectrum[static_cast<size_t>(bin) * 2] = static_cast<float>(magnitudes[static_cast<size_t>(bin)]);
+
+    fft.performRealOnlyInverseTransform(spectrum.data());
+
+    // The zero phase response wraps around sample 0; rotating it by half the
+    // kernel centres it, and a periodic Hann window keeps it symmetric.
+    juce::AudioBuffer<float> kernel(1, kernelSize);
+    auto* taps = kernel.getWritePointer(0);
+
+    for (int i = 0; i < kernelSize; i++)
+    {
+        auto window = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * i / kernelSize);
+        taps[i] = static_cast<float>(spectrum[static_cast<size_t>((i + kernelSize / 2) % kernelSize)] * window);
+    }
+
+    return kernel;
+}
+
+void LinearPhaseFilter::loadKernel(const juce::AudioBuffer<float>& kernel)
+{
+    for (auto& convolution : convolutions)
+    {
+        juce::AudioBuffer<float> copy(kernel);
+        convolution->loadImpulseResponse(std::move(copy),
+            processSpec.sampleRate,
+            juce::dsp::Convolution::Stereo::no,
+            juce::dsp::Convolution::Trim::no,
+            juce::dsp::Convolution::Normalise::no);
+    }
+}
@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    LinearPhaseFilter.h
+    Created: 18 Oct 2026 6:14:37pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FilterCascade.h"
+
+// A linear phase version of the low cut -> peak -> high cut chain: a
+// symmetric FIR kernel sampled from the magnitude response of the cascade
+// and run through juce::dsp::Convolution.
+//
+// Kernels are designed on a background thread. The audio thread only flags
+// that one is needed, and the convolution engines load the new kernel on
+// their own message queue and crossfade to it, so nothing on the audio
+// thread ever waits for an FFT.
+//
+// None of that exists until activate(): with linear phase off, an instance
+// holds no engines and runs no threads.
+class LinearPhaseFilter : private juce::Thread
+{
+public:
+    // Designs the cascade the kernel should follow and returns the sample
+    // rate it was designed at, which may be higher than the processing rate.
+    using DesignFunction = std::function<double(FilterCascade<float>& cascade)>;
+
+    explicit LinearPhaseFilter(DesignFunction designFunction);
+    ~LinearPhaseFilter() override;
+
+    // Not realtime safe. Records the spec and deactivates the filter.
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    // Not realtime safe, and process() mustn't be running. Creates the
+    // engines and the design thread, and loads a kernel designed on the
+    // calling thread, so the next process() call already runs it.
+    void activate();
+
+    // Not realtime safe, and process() mustn't be running. Stops the design
+    // thread and frees the engines.
+    void deactivate();
+
+    bool isActive() const { return active; }
+
+    // Safe from any thread. Does nothing while deactivated; activate()
+    // always designs a fresh kernel.
+    void triggerRebuild();
+
+    // Half the kernel, the delay of a symmetric FIR.
+    int getLatencySamples() const { return kernelSize / 2; }
+
+    void process(const juce::dsp::ProcessContextReplacing<float>& context);
+
+    // Convolution only runs in float, so this goes through a scratch buffer.
+    void process(const juce::dsp::ProcessContextReplacing<double>& context);
+
+private:
+    // 32768 taps at 44.1 and 48 kHz, about 1.5 Hz between bins, so the
+    // window still resolves a steep 20 Hz low cut or a narrow low peak. The
+    // price is a latency of half that: 16384 samples, 341 ms at 48 kHz.
+    static constexpr double kernelLengthSeconds = 0.68;
+    static constexpr int pollIntervalMs = 20;
+
+    void run() override;
+
+    juce::AudioBuffer<float> designKernel();
+    void loadKernel(const juce::AudioBuffer<float>& kernel);
+    void prepareConvolutions();
+
+    DesignFunction design;
+
+    std::atomic<bool> rebuildNeeded{ false };
+    juce::dsp::ProcessSpec processSpec{ 44100.0, 0, 0 };
+    int kernelSize{ 0 };
+    bool active{ false };
+
+    // One stereo engine per pair of channels, all fed the same mono kernel.
+    // The queue runs a thread of its own, so it only exists while active.
+    std::unique_ptr<juce::dsp::ConvolutionMessageQueue> messageQueue;
+    std::vector<std::unique_ptr<juce::dsp::Convolution>> convolutions;
+
+    juce::AudioBuffer<float> conversionBuffer;
+};
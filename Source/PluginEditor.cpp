@@ -25,7 +25,9 @@ SimpleEQAudioProcessorEditor::SimpleEQAudioProcessorEditor (SimpleEQAudioProcess
     lowCutFreqSliderAttachment(audioProcessor.apvts, LOW_CUT, lowCutFreqSlider),
     highCutFreqSliderAttachment(audioProcessor.apvts, HIGH_CUT, highCutFreqSlider),
     lowCutSlopeSliderAttachment(audioProcessor.apvts, LOW_GAIN, lowCutSlopeSlider),
-    highCutSlopeSliderAttachment(audioProcessor.apvts, HIGH_GAIN, highCutSlopeSlider)
+    highCutSlopeSliderAttachment(audioProcessor.apvts, HIGH_GAIN, highCutSlopeSlider),
+    smoothingButtonAttachment(audioProcessor.apvts, SMOOTHING, smoothingButton),
+    linearPhaseButtonAttachment(audioProcessor.apvts, LINEAR_PHASE, linearPhaseButton)
 {
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
@@ -36,6 +38,17 @@ SimpleEQAudioProcessorEditor::SimpleEQAudioProcessorEditor (SimpleEQAudioProcess
 
     createLabels();
 
+    if (auto* choice = dynamic_cast<juce::AudioParameterChoice*>(audioProcessor.apvts.getParameter(OVERSAMPLING)))
+        oversamplingBox.addItemList(choice->choices, 1);
+
+    oversamplingBoxAttachment = std::make_unique<APVTS::ComboBoxAttachment>(audioProcessor.apvts, OVERSAMPLING, oversamplingBox);
+
+   #if SIMPLEEQ_DSP_LOAD_METER
+    loadLabel.setJustificationType(juce::Justification::centred);
+    addAndMakeVisible(loadLabel);
+    startTimerHz(4);
+   #endif
+
     setSize(400, 500);
 }
 
@@ -61,6 +74,17 @@ void SimpleEQAudioProcessorEditor::resized()
     // subcomponents in your editor..
 
     auto bounds = getLocalBounds();
+
+    auto modeArea = bounds.removeFromBottom(24);
+
+   #if SIMPLEEQ_DSP_LOAD_METER
+    loadLabel.setBounds(modeArea.removeFromRight(modeArea.getWidth() * 0.35));
+   #endif
+
+    smoothingButton.setBounds(modeArea.removeFromLeft(modeArea.getWidth() * 0.33));
+    oversamplingBox.setBounds(modeArea.removeFromRight(modeArea.getWidth() * 0.5));
+    linearPhaseButton.setBounds(modeArea);
+
     auto responseArea = bounds.removeFromTop(bounds.getHeight() * 0.33);
 
     responseCurve.setBounds(responseArea);
@@ -81,6 +105,30 @@ void SimpleEQAudioProcessorEditor::resized()
     peakQualitySlider.setBounds(bounds);
 }
 
+void SimpleEQAudioProcessorEditor::timerCallback()
+{
+    // Average and peak share of the real time budget over the recent blocks.
+    auto reading = audioProcessor.getDspLoadMeter().getReading();
+
+    if (reading.numBlocks == 0)
+    {
+        loadLabel.setText("DSP --", juce::dontSendNotification);
+        return;
+    }
+
+    auto text = "DSP " + juce::String(reading.averageLoad * 100.f, 1) + "% / "
+              + juce::String(reading.peakLoad * 100.f, 1) + "%";
+
+    // How often a peak design was found in the coefficient cache.
+    auto cacheStats = CoefficientCache::getStats();
+    auto numLookups = cacheStats.hits + cacheStats.misses;
+
+    if (numLookups > 0)
+        text << ", cache " << juce::String(100.0 * static_cast<double>(cacheStats.hits) / static_cast<double>(numLookups), 0) << "% hits";
+
+    loadLabel.setText(text, juce::dontSendNotification);
+}
+
 void SimpleEQAudioProcessorEditor::createLabels()
 {
     peakFreqSlider.labels.add(RotarySliderWithLabels::LabelPos{0.f, "20 Hz"});
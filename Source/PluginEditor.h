@@ -16,7 +16,8 @@
 //==============================================================================
 /**
 */
-class SimpleEQAudioProcessorEditor  : public juce::AudioProcessorEditor
+class SimpleEQAudioProcessorEditor  : public juce::AudioProcessorEditor,
+    juce::Timer
 {
 public:
     SimpleEQAudioProcessorEditor (SimpleEQAudioProcessor&);
@@ -26,6 +27,9 @@ public:
     void paint (juce::Graphics&) override;
     void resized() override;
 
+    // Refreshes the DSP load readout.
+    void timerCallback() override;
+
 private:
     void createLabels();
 
@@ -42,6 +46,13 @@ private:
         lowCutSlopeSlider,
         highCutSlopeSlider;
 
+    juce::ToggleButton smoothingButton{ "Smooth" };
+    juce::ToggleButton linearPhaseButton{ "Linear Phase" };
+    juce::ComboBox oversamplingBox;
+
+    // Only shown when the load meter is compiled in.
+    juce::Label loadLabel;
+
     std::vector<juce::Component*> components
     { 
         &responseCurve,
@@ -51,7 +62,10 @@ private:
         &lowCutFreqSlider,
         &highCutFreqSlider,
         &lowCutSlopeSlider,
-        &highCutSlopeSlider
+        &highCutSlopeSlider,
+        &smoothingButton,
+        &linearPhaseButton,
+        &oversamplingBox
     };
 
     using APVTS = juce::AudioProcessorValueTreeState;
@@ -65,5 +79,11 @@ private:
         lowCutSlopeSliderAttachment,
         highCutSlopeSliderAttachment;
 
+    APVTS::ButtonAttachment smoothingButtonAttachment,
+        linearPhaseButtonAttachment;
+
+    // Created once the box has its items, so the attachment can select one.
+    std::unique_ptr<APVTS::ComboBoxAttachment> oversamplingBoxAttachment;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimpleEQAudioProcessorEditor)
 };
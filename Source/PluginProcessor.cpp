@@ -29,6 +29,10 @@ SimpleEQAudioProcessor::SimpleEQAudioProcessor()
     peakFreq = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(PEAK_FREQ));
     peakGain = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(PEAK_GAIN));
     peakQuality = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(PEAK_QUALITY));
+    smoothing = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter(SMOOTHING));
+    oversampling = dynamic_cast<juce::AudioParameterChoice*>(apvts.getParameter(OVERSAMPLING));
+    linearPhase = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter(LINEAR_PHASE));
+    controlRate = dynamic_cast<juce::AudioParameterChoice*>(apvts.getParameter(CONTROL_RATE));
 
     jassert(lowCutFreq != nullptr);
     jassert(highCutFreq != nullptr);
@@ -37,10 +41,28 @@ SimpleEQAudioProcessor::SimpleEQAudioProcessor()
     jassert(peakFreq != nullptr);
     jassert(peakGain != nullptr);
     jassert(peakQuality != nullptr);
+    jassert(smoothing != nullptr);
+    jassert(oversampling != nullptr);
+    jassert(linearPhase != nullptr);
+    jassert(controlRate != nullptr);
+
+    for (auto& id : { LOW_CUT, HIGH_CUT, LOW_GAIN, HIGH_GAIN, PEAK_FREQ, PEAK_GAIN, PEAK_QUALITY, OVERSAMPLING, LINEAR_PHASE })
+    {
+        apvts.addParameterListener(id, this);
+    }
+
+    startTimer(tailCheckIntervalMs);
 }
 
 SimpleEQAudioProcessor::~SimpleEQAudioProcessor()
 {
+    for (auto& id : { LOW_CUT, HIGH_CUT, LOW_GAIN, HIGH_GAIN, PEAK_FREQ, PEAK_GAIN, PEAK_QUALITY, OVERSAMPLING, LINEAR_PHASE })
+    {
+        apvts.removeParameterListener(id, this);
+    }
+
+    stopTimer();
+    cancelPendingUpdate();
 }
 
 //==============================================================================
@@ -76,9 +98,14 @@ bool SimpleEQAudioProcessor::isMidiEffect() const
    #endif
 }
 
+bool SimpleEQAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
 double SimpleEQAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return tailLengthSeconds.load();
 }
 
 int SimpleEQAudioProcessor::getNumPrograms()
@@ -111,9 +138,153 @@ void SimpleEQAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlo
     // Use this method as the place to do any pre-playback
     // initialisation that you need..
 
-    juce::dsp::ProcessSpec spec{ sampleRate, samplesPerBlock, 1 };
-    leftChain.prepare(spec);
-    rightChain.prepare(spec);
+    maximumBlockSize = samplesPerBlock;
+    dspLoadMeter.prepare(sampleRate);
+    analyzerTap.prepare(sampleRate);
+
+    prepareOversamplers(floatEngines);
+    prepareOversamplers(doubleEngines);
+
+    // Every rate the filters can run at, so switching factor only has to
+    // pick one.
+    for (int order = 0; order <= maxOversamplingOrder; order++)
+    {
+        auto processingRate = sampleRate * (1 << order);
+        auto& table = cutFilterTables[order];
+
+        if (table == nullptr || table->getSampleRate() != processingRate)
+            std::atomic_store(&table, CutFilterTable::getForSampleRate(processingRate));
+    }
+
+    oversamplingOrder.store(oversampling->getIndex());
+    prepareFilterChains();
+
+    // Linear phase runs at the host rate; its kernel already follows the
+    // oversampled design, so the factor has to be set first. activate() loads
+    // the first kernel before it returns, so an offline render comes out the
+    // same every time. With linear phase off, nothing is allocated for it
+    // until handleAsyncUpdate switches it on.
+    linearPhaseFilter.prepare({ sampleRate,
+                                static_cast<juce::uint32>(samplesPerBlock),
+                                static_cast<juce::uint32>(getTotalNumOutputChannels()) });
+
+    if (linearPhase->get())
+        linearPhaseFilter.activate();
+
+    linearPhaseActive.store(linearPhase->get());
+
+    updateLatency();
+
+    wasSmoothing = smoothing->get();
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::prepareOversamplers(Engines<SampleType>& engines)
+{
+    for (int order = 1; order <= maxOversamplingOrder; order++)
+    {
+        auto& oversampler = engines.oversamplers[order - 1];
+
+        oversampler = std::make_unique<juce::dsp::Oversampling<SampleType>>(
+            static_cast<size_t>(getTotalNumOutputChannels()),
+            static_cast<size_t>(order),
+            juce::dsp::Oversampling<SampleType>::filterHalfBandPolyphaseIIR,
+            true,
+            true);
+
+        oversampler->initProcessing(static_cast<size_t>(maximumBlockSize));
+    }
+}
+
+void SimpleEQAudioProcessor::prepareFilterChains()
+{
+    // Always sized for the highest factor, so a factor change only has to
+    // reset them.
+    juce::dsp::ProcessSpec spec{ getProcessingSampleRate(),
+                                 static_cast<juce::uint32>(maximumBlockSize << maxOversamplingOrder),
+                                 static_cast<juce::uint32>(getTotalNumOutputChannels()) };
+    floatEngines.processingChain.prepare(spec);
+    doubleEngines.processingChain.prepare(spec);
+
+    invalidateFilters();
+    updateMonoChains();
+
+    // Stages switched on or off by that first update start out in place
+    // rather than fading.
+    floatEngines.processingChain.reset();
+    doubleEngines.processingChain.reset();
+
+    floatEngines.smoothedChain.prepare(spec);
+    floatEngines.smoothedChain.setCurrentSettings(getPeakSettings(), getLowCutSettings(), getHighCutSettings());
+    doubleEngines.smoothedChain.prepare(spec);
+    doubleEngines.smoothedChain.setCurrentSettings(getPeakSettings(), getLowCutSettings(), getHighCutSettings());
+
+    for (auto& oversampler : floatEngines.oversamplers)
+        oversampler->reset();
+
+    for (auto& oversampler : doubleEngines.oversamplers)
+        oversampler->reset();
+}
+
+void SimpleEQAudioProcessor::updateLatency()
+{
+    auto order = oversamplingOrder.load();
+
+    if (linearPhaseActive.load())
+        setLatencySamples(linearPhaseFilter.getLatencySamples());
+    else
+        setLatencySamples(order > 0 ? juce::roundToInt(floatEngines.oversamplers[order - 1]->getLatencyInSamples()) : 0);
+}
+
+juce::StringArray SimpleEQAudioProcessor::getParameterNames() const
+{
+    juce::StringArray names;
+
+    for (auto* parameter : getParameters())
+        names.add(parameter->getName(Telemetry::maxNameLength - 1));
+
+    return names;
+}
+
+void SimpleEQAudioProcessor::fillTelemetry(Telemetry::Snapshot& snapshot) const
+{
+    auto reading = dspLoadMeter.getReading();
+    auto totals = dspLoadMeter.getTotals();
+
+    snapshot.sampleRate = getSampleRate();
+    snapshot.blockSize = getBlockSize();
+    snapshot.averageLoad = reading.averageLoad;
+    snapshot.peakLoad = reading.peakLoad;
+
+    if (snapshot.sampleRate > 0.0)
+        snapshot.averageBlockMicroseconds = static_cast<float>(reading.averageLoad * snapshot.blockSize / snapshot.sampleRate * 1.0e6);
+
+    snapshot.numBlocks = totals.numBlocks;
+    snapshot.numNearBudget = totals.numNearBudget;
+    snapshot.numOverBudget = totals.numOverBudget;
+    snapshot.numRecomputes = totals.numRecomputes;
+
+    auto cacheStats = CoefficientCache::getStats();
+    snapshot.numCacheHits = cacheStats.hits;
+    snapshot.numCacheMisses = cacheStats.misses;
+
+    auto& parameters = getParameters();
+    snapshot.numParameters = juce::jmin(parameters.size(), Telemetry::maxParameters);
+
+    for (int i = 0; i < snapshot.numParameters; i++)
+    {
+        auto* parameter = parameters[i];
+
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+            snapshot.parameters[static_cast<size_t>(i)] = ranged->convertFrom0to1(ranged->getValue());
+        else
+            snapshot.parameters[static_cast<size_t>(i)] = parameter->getValue();
+    }
+}
+
+double SimpleEQAudioProcessor::getProcessingSampleRate() const
+{
+    return getSampleRate() * (1 << oversamplingOrder.load());
 }
 
 void SimpleEQAudioProcessor::releaseResources()
@@ -129,12 +300,14 @@ bool SimpleEQAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts)
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
+    // Any channel layout works (mono, stereo, surround, immersive, ambisonics),
+    // as every channel runs through the same cascade with shared coefficients.
     // Some plugin hosts, such as certain GarageBand versions, will only
     // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    auto outputChannels = layouts.getMainOutputChannelSet();
+
+    if (outputChannels.isDisabled()
+     || outputChannels.size() > static_cast<int>(SIMDFilterChain<float>::maxChannels))
         return false;
 
     // This checks if the input layout matches the output layout
@@ -150,6 +323,19 @@ bool SimpleEQAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts)
 
 void SimpleEQAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    processSamples(buffer);
+}
+
+void SimpleEQAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processSamples(buffer);
+}
+
+template <typename SampleType>
+void SimpleEQAudioProcessor::processSamples(juce::AudioBuffer<SampleType>& buffer)
+{
+    const RealtimeSafety::ScopedRealtimeSection realtimeSection;
+    const DspLoadMeter::ScopedBlock loadMeasurement(dspLoadMeter, buffer.getNumSamples());
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -163,93 +349,370 @@ void SimpleEQAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    updateMonoChains(std::vector<MonoChain*>{&leftChain, &rightChain});
+    analyzerTap.push(AnalyzerTap::Input, buffer, totalNumInputChannels);
+
+    // A new factor only shows up here once handleAsyncUpdate has prepared
+    // everything for it.
+    auto order = oversamplingOrder.load();
 
-    juce::dsp::AudioBlock<float> block(buffer);
+    auto& engines = getEngines<SampleType>();
+    juce::dsp::AudioBlock<SampleType> block(buffer);
 
-    auto leftBlock = block.getSingleChannelBlock(0);
-    auto rightBlock = block.getSingleChannelBlock(1);
+    // Every mode keeps the processing chain designed, so switching back to
+    // it is seamless and the response curve always has coefficients to show.
+    updateMonoChains();
 
-    juce::dsp::ProcessContextReplacing<float> leftContext(leftBlock);
-    juce::dsp::ProcessContextReplacing<float> rightContext(rightBlock);
+    if (linearPhaseActive.load())
+    {
+        linearPhaseFilter.process(juce::dsp::ProcessContextReplacing<SampleType>(block));
+        analyzerTap.push(AnalyzerTap::Output, buffer, totalNumOutputChannels);
+        return;
+    }
+
+    auto isSmoothing = smoothing->get();
+
+    // The engine being switched to still holds state from whenever it last ran.
+    if (isSmoothing != wasSmoothing)
+    {
+        if (isSmoothing)
+        {
+            engines.smoothedChain.reset();
+            engines.smoothedChain.setCurrentSettings(getPeakSettings(), getLowCutSettings(), getHighCutSettings());
+        }
+        else
+        {
+            engines.processingChain.reset();
+        }
+
+        wasSmoothing = isSmoothing;
+    }
+
+    if (isSmoothing)
+    {
+        engines.smoothedChain.setControlRateDivisor(getControlRateDivisor());
+        engines.smoothedChain.setTargetSettings(getPeakSettings(), getLowCutSettings(), getHighCutSettings());
+    }
+
+    auto* oversampler = order > 0 ? engines.oversamplers[order - 1].get() : nullptr;
+
+    // The oversamplers only hold the prepared block size, and some hosts send
+    // more than they announced, so longer blocks go up, through the filters
+    // and back down a piece at a time.
+    auto pieceSize = static_cast<size_t>(juce::jmax(1, maximumBlockSize));
 
-    leftChain.process(leftContext);
-    rightChain.process(rightContext);
+    for (size_t start = 0; start < block.getNumSamples(); start += pieceSize)
+    {
+        auto piece = block.getSubBlock(start, juce::jmin(pieceSize, block.getNumSamples() - start));
+        auto processingBlock = oversampler != nullptr ? oversampler->processSamplesUp(piece) : piece;
+        juce::dsp::ProcessContextReplacing<SampleType> context(processingBlock);
+
+        if (isSmoothing)
+            engines.smoothedChain.process(context);
+        else
+            engines.processingChain.process(context);
+
+        if (oversampler != nullptr)
+            oversampler->processSamplesDown(piece);
+    }
+
+    analyzerTap.push(AnalyzerTap::Output, buffer, totalNumOutputChannels);
 }
 
 void SimpleEQAudioProcessor::updateMonoChain(MonoChain& monoChain)
 {
-    updateMonoChains(std::vector<MonoChain*>{ &monoChain });
+    auto sampleRate = getProcessingSampleRate();
+
+    auto peak = getPeakSettings();
+    monoChain.setPeakCoefficients(CoefficientCache::getPeakCoefficients(sampleRate, peak.freq, peak.quality, peak.gainInDecibels));
+    monoChain.setStageEnabled(CascadeStage::Peak, !isNeutral(peak));
+
+    // The same interpolated designs updateCutFilters gives the processing
+    // chains, so the curve and the linear phase kernel match what's heard.
+    // Before the first prepareToPlay there's no table yet to match.
+    auto table = std::atomic_load(&cutFilterTables[static_cast<size_t>(oversamplingOrder.load())]);
+
+    if (table != nullptr && table->getSampleRate() != sampleRate)
+        table = nullptr;
+
+    CutCoefficients coefficients;
+
+    auto lowCut = getLowCutSettings();
+
+    if (table != nullptr)
+        table->getLowCutCoefficients(coefficients, lowCut.freq, lowCut.gainIndex);
+    else
+        CoefficientCache::getLowCutCoefficients(coefficients, sampleRate, lowCut.freq, (lowCut.gainIndex + 1) * 2);
+
+    monoChain.setLowCutCoefficients(coefficients);
+    monoChain.setStageEnabled(CascadeStage::LowCut, !isLowCutNeutral(lowCut));
+
+    auto highCut = getHighCutSettings();
+
+    if (table != nullptr)
+        table->getHighCutCoefficients(coefficients, highCut.freq, highCut.gainIndex);
+    else
+        CoefficientCache::getHighCutCoefficients(coefficients, sampleRate, highCut.freq, (highCut.gainIndex + 1) * 2);
+
+    monoChain.setHighCutCoefficients(coefficients);
+    monoChain.setStageEnabled(CascadeStage::HighCut, !isHighCutNeutral(highCut));
+}
+
+void SimpleEQAudioProcessor::updateMonoChains()
+{
+    updatePeakFilter();
+    updateCutFilters();
+
+    if (coefficientsChanged)
+    {
+        coefficientsChanged = false;
+
+        activeCoefficients.version++;
+        activeCoefficients.sampleRate = getProcessingSampleRate();
+        coefficientSnapshots.write(activeCoefficients);
+    }
+}
+
+const CoefficientSnapshot& SimpleEQAudioProcessor::getCoefficientSnapshot()
+{
+    coefficientSnapshots.update();
+    return coefficientSnapshots.get();
 }
 
-void SimpleEQAudioProcessor::updateMonoChains(std::vector<MonoChain*>& monoChains)
+void SimpleEQAudioProcessor::updateTailLength()
 {
-    updatePeakFilter(monoChains);
-    updateCutFilters(monoChains);
+    // The time for a full scale signal to ring down to where the processing
+    // chain treats it as silence.
+    auto decayTime = floatEngines.processingChain.getCascade().getDecayTimeSamples(SIMDFilterChain<float>::noiseFloor);
+
+    tailLengthSeconds.store(decayTime / getProcessingSampleRate());
 }
 
-void SimpleEQAudioProcessor::updatePeakFilter(std::vector<MonoChain*>& monoChains)
+void SimpleEQAudioProcessor::timerCallback()
 {
-    auto peakCoefficients = juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-        getSampleRate(),
-        peakFreq->get(),
-        peakQuality->get(),
-        juce::Decibels::decibelsToGain(peakGain->get()));
+    auto tailLength = tailLengthSeconds.load();
+    auto change = std::abs(tailLength - reportedTailLengthSeconds);
+
+    // Hosts cache getTailLengthSeconds(), so they only see a new value when
+    // asked to look again. Small moves aren't worth making them do that.
+    if (change <= tailChangeThreshold * juce::jmax(tailLength, reportedTailLengthSeconds))
+        return;
+
+    reportedTailLengthSeconds = tailLength;
+    updateHostDisplay(ChangeDetails().withNonParameterStateChanged(true));
+}
+
+void SimpleEQAudioProcessor::updatePeakFilter()
+{
+    // The flag is cleared before the parameters are read, so a change that
+    // lands while we're designing is picked up on the next block.
+    if (!peakDirty.compareAndSetBool(false, true))
+        return;
+
+    auto settings = getPeakSettings();
 
-    for (MonoChain* monoChain : monoChains)
+    if (settings == appliedPeakSettings)
+        return;
+
+    appliedPeakSettings = settings;
+
+    auto peakCoefficients = CoefficientCache::getPeakCoefficients(getProcessingSampleRate(),
+        settings.freq,
+        settings.quality,
+        settings.gainInDecibels);
+
+    floatEngines.processingChain.setPeakCoefficients(peakCoefficients);
+    doubleEngines.processingChain.setPeakCoefficients(peakCoefficients);
+
+    floatEngines.processingChain.setStageEnabled(CascadeStage::Peak, !isNeutral(settings));
+    doubleEngines.processingChain.setStageEnabled(CascadeStage::Peak, !isNeutral(settings));
+
+    activeCoefficients.peak = peakCoefficients;
+    activeCoefficients.peakEnabled = !isNeutral(settings);
+    coefficientsChanged = true;
+
+    updateTailLength();
+    dspLoadMeter.addRecompute();
+}
+
+void SimpleEQAudioProcessor::updateCutFilters()
+{
+    auto& cutFilterTable = cutFilterTables[oversamplingOrder.load()];
+
+    if (lowCutDirty.compareAndSetBool(false, true))
     {
-        *monoChain->get<ChainPositions::PEAK_FILTER>().coefficients = *peakCoefficients;
+        auto settings = getLowCutSettings();
+
+        if (settings != appliedLowCutSettings)
+        {
+            appliedLowCutSettings = settings;
+
+            cutFilterTable->getLowCutCoefficients(cutCoefficients, settings.freq, settings.gainIndex);
+
+            floatEngines.processingChain.setLowCutCoefficients(cutCoefficients);
+            doubleEngines.processingChain.setLowCutCoefficients(cutCoefficients);
+
+            floatEngines.processingChain.setStageEnabled(CascadeStage::LowCut, !isLowCutNeutral(settings));
+            doubleEngines.processingChain.setStageEnabled(CascadeStage::LowCut, !isLowCutNeutral(settings));
+
+            activeCoefficients.lowCut = cutCoefficients;
+            activeCoefficients.lowCutEnabled = !isLowCutNeutral(settings);
+            coefficientsChanged = true;
+
+            updateTailLength();
+            dspLoadMeter.addRecompute();
+        }
+    }
+
+    if (highCutDirty.compareAndSetBool(false, true))
+    {
+        auto settings = getHighCutSettings();
+
+        if (settings != appliedHighCutSettings)
+        {
+            appliedHighCutSettings = settings;
+
+            cutFilterTable->getHighCutCoefficients(cutCoefficients, settings.freq, settings.gainIndex);
+
+            floatEngines.processingChain.setHighCutCoefficients(cutCoefficients);
+            doubleEngines.processingChain.setHighCutCoefficients(cutCoefficients);
+
+            floatEngines.processingChain.setStageEnabled(CascadeStage::HighCut, !isHighCutNeutral(settings));
+            doubleEngines.processingChain.setStageEnabled(CascadeStage::HighCut, !isHighCutNeutral(settings));
+
+            activeCoefficients.highCut = cutCoefficients;
+            activeCoefficients.highCutEnabled = !isHighCutNeutral(settings);
+            coefficientsChanged = true;
+
+            updateTailLength();
+            dspLoadMeter.addRecompute();
+        }
     }
 }
 
-void SimpleEQAudioProcessor::updateCutFilters(std::vector<MonoChain*>& monoChains)
+int SimpleEQAudioProcessor::getControlRateDivisor() const
 {
-    auto lowCutGainIndex = lowCutGain->getIndex();
-    auto highCutGainIndex = highCutGain->getIndex();
+    auto index = juce::jlimit(0, static_cast<int>(controlRateDivisors.size()) - 1, controlRate->getIndex());
+    return controlRateDivisors[static_cast<size_t>(index)];
+}
 
-    auto lowPassOrder = (lowCutGainIndex + 1) * 2;
-    auto highPassOrder = (highCutGainIndex + 1) * 2;
+PeakSettings SimpleEQAudioProcessor::getPeakSettings() const
+{
+    return { peakFreq->get(), peakGain->get(), peakQuality->get() };
+}
 
-    auto lowCutCoefficients = juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(lowCutFreq->get(),
-        getSampleRate(),
-        lowPassOrder);
-    auto highCutCoefficients = juce::dsp::FilterDesign<float>::designIIRLowpassHighOrderButterworthMethod(highCutFreq->get(),
-        getSampleRate(),
-        highPassOrder);
+CutSettings SimpleEQAudioProcessor::getLowCutSettings() const
+{
+    return { lowCutFreq->get(), lowCutGain->getIndex() };
+}
+
+CutSettings SimpleEQAudioProcessor::getHighCutSettings() const
+{
+    return { highCutFreq->get(), highCutGain->getIndex() };
+}
+
+bool SimpleEQAudioProcessor::isNeutral(const PeakSettings& settings) const
+{
+    return settings.gainInDecibels == 0.f;
+}
+
+bool SimpleEQAudioProcessor::isLowCutNeutral(const CutSettings& settings) const
+{
+    return settings.freq <= lowCutFreq->range.start;
+}
+
+bool SimpleEQAudioProcessor::isHighCutNeutral(const CutSettings& settings) const
+{
+    return settings.freq >= highCutFreq->range.end;
+}
 
-    for (MonoChain* monoChain : monoChains)
+void SimpleEQAudioProcessor::parameterChanged(const juce::String& parameterID, float newValue)
+{
+    if (parameterID == PEAK_FREQ || parameterID == PEAK_GAIN || parameterID == PEAK_QUALITY)
+        peakDirty.set(true);
+    else if (parameterID == LOW_CUT || parameterID == LOW_GAIN)
+        lowCutDirty.set(true);
+    else if (parameterID == HIGH_CUT || parameterID == HIGH_GAIN)
+        highCutDirty.set(true);
+    else if (parameterID == OVERSAMPLING || parameterID == LINEAR_PHASE)
     {
-        auto& lowCut = monoChain->get<ChainPositions::LOW_CUT_FILTER>();
-        auto& highCut = monoChain->get<ChainPositions::HIGH_CUT_FILTER>();
+        // Both change the latency, which can't be reported from the audio
+        // thread.
+        triggerAsyncUpdate();
+
+        if (juce::MessageManager::existsAndIsCurrentThread())
+            handleUpdateNowIfNeeded();
 
-        setCutFilterParams(lowCut, lowCutCoefficients, lowCutGainIndex);
-        setCutFilterParams(highCut, highCutCoefficients, highCutGainIndex);
+        return;
     }
+
+    if (linearPhase->get())
+        linearPhaseFilter.triggerRebuild();
 }
 
-void SimpleEQAudioProcessor::setCutFilterParams(CutFilter& filterChain, 
-                                             juce::ReferenceCountedArray<juce::dsp::IIR::Coefficients<float>>& cutCoefficients,
-                                             int numFilters)
+void SimpleEQAudioProcessor::handleAsyncUpdate()
 {
-    jassert(numFilters <= cutCoefficients.size());
+    // Not prepared yet; prepareToPlay reads both parameters itself.
+    if (maximumBlockSize == 0)
+        return;
 
-    filterChain.setBypassed<0>(true);
-    filterChain.setBypassed<1>(true);
-    filterChain.setBypassed<2>(true);
-    filterChain.setBypassed<3>(true);
+    auto order = oversampling->getIndex();
+    auto isLinearPhase = linearPhase->get();
 
-    switch (numFilters)
+    if (order == oversamplingOrder.load() && isLinearPhase == linearPhaseActive.load())
+        return;
+
+    // The chains, the kernel and the latency change together, so
+    // processBlock is held off until all of them are ready. The host fills
+    // in silence meanwhile.
+    suspendProcessing(true);
+
+    if (order != oversamplingOrder.load())
     {
-    case 3:
-        updateAndEnableFilter<3>(filterChain, cutCoefficients);
-    case 2:
-        updateAndEnableFilter<2>(filterChain, cutCoefficients);
-    case 1:
-        updateAndEnableFilter<1>(filterChain, cutCoefficients);
-    case 0:
-        updateAndEnableFilter<0>(filterChain, cutCoefficients);
-        break;
+        oversamplingOrder.store(order);
+        prepareFilterChains();
+
+        // The kernel follows the design rate.
+        linearPhaseFilter.triggerRebuild();
     }
+
+    // The mode being switched to still holds state from whenever it last ran.
+    if (isLinearPhase != linearPhaseActive.load())
+    {
+        if (isLinearPhase)
+        {
+            // Loaded before the switch, so the first block after it already
+            // runs a kernel for the current settings.
+            linearPhaseFilter.activate();
+        }
+        else
+        {
+            // Nothing of the linear phase filter is kept while it's off.
+            linearPhaseFilter.deactivate();
+
+            floatEngines.processingChain.reset();
+            floatEngines.smoothedChain.reset();
+            doubleEngines.processingChain.reset();
+            doubleEngines.smoothedChain.reset();
+        }
+
+        linearPhaseActive.store(isLinearPhase);
+    }
+
+    updateLatency();
+
+    suspendProcessing(false);
+}
+
+void SimpleEQAudioProcessor::invalidateFilters()
+{
+    // Forces a full redesign on the next update, e.g. after a sample rate change.
+    appliedPeakSettings = {};
+    appliedLowCutSettings = {};
+    appliedHighCutSettings = {};
+
+    peakDirty.set(true);
+    lowCutDirty.set(true);
+    highCutDirty.set(true);
 }
 
 //==============================================================================
@@ -334,6 +797,31 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleEQAudioProcessor::crea
         PEAK_QUALITY,
         juce::NormalisableRange<float>(0.1f, 10.f, 0.05f, 0.33f),
         1));
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        SMOOTHING,
+        SMOOTHING,
+        false));
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        OVERSAMPLING,
+        OVERSAMPLING,
+        juce::StringArray{ "Off", "2x", "4x" },
+        0));
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        LINEAR_PHASE,
+        LINEAR_PHASE,
+        false));
+
+    juce::StringArray controlRateChoices;
+    for (auto divisor : controlRateDivisors)
+    {
+        controlRateChoices.add(juce::String(divisor));
+    }
+
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        CONTROL_RATE,
+        CONTROL_RATE,
+        controlRateChoices,
+        2));
 
     return layout;
 }
@@ -9,6 +9,18 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "AnalyzerTap.h"
+#include "CoefficientCache.h"
+#include "CoefficientDesign.h"
+#include "CutFilterTable.h"
+#include "DspLoadMeter.h"
+#include "FilterCascade.h"
+#include "LinearPhaseFilter.h"
+#include "RealtimeSafety.h"
+#include "SIMDFilterChain.h"
+#include "SmoothedFilterChain.h"
+#include "TelemetryExport.h"
+#include "TripleBuffer.h"
 
 inline const juce::String LOW_CUT = "Low Cut";
 inline const juce::String HIGH_CUT = "High Cut";
@@ -17,22 +29,20 @@ inline const juce::String HIGH_GAIN = "High Gain";
 inline const juce::String PEAK_FREQ = "Peak Freq";
 inline const juce::String PEAK_GAIN = "Peak Gain";
 inline const juce::String PEAK_QUALITY = "Peak Quality";
+inline const juce::String SMOOTHING = "Smoothing";
+inline const juce::String OVERSAMPLING = "Oversampling";
+inline const juce::String LINEAR_PHASE = "Linear Phase";
+inline const juce::String CONTROL_RATE = "Control Rate";
 
-using Filter = juce::dsp::IIR::Filter<float>;
-using CutFilter = juce::dsp::ProcessorChain<Filter, Filter, Filter, Filter>;
-using MonoChain = juce::dsp::ProcessorChain<CutFilter, Filter, CutFilter>;
-
-enum ChainPositions
-{
-    LOW_CUT_FILTER,
-    PEAK_FILTER,
-    HIGH_CUT_FILTER
-};
+using MonoChain = FilterCascade<float>;
 
 //==============================================================================
 /**
 */
-class SimpleEQAudioProcessor  : public juce::AudioProcessor
+class SimpleEQAudioProcessor  : public juce::AudioProcessor,
+    juce::AudioProcessorValueTreeState::Listener,
+    juce::AsyncUpdater,
+    juce::Timer
 {
 public:
     //==============================================================================
@@ -48,6 +58,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -76,10 +88,38 @@ public:
     static APVTS::ParameterLayout createParameterLayout();
     APVTS apvts{ *this, nullptr, "Parameters", createParameterLayout() };
 
+    // Designs every band of the given chain from the current parameter values,
+    // the cuts from the same table the processing chains use.
     void updateMonoChain(MonoChain& monoChain);
-    void updateMonoChains(std::vector<MonoChain*>& monoChains);
-    void updatePeakFilter(std::vector<MonoChain*>& monoChains);
-    void updateCutFilters(std::vector<MonoChain*>& monoChains);
+
+    // Audio thread only. These redesign a band of the processing chains only
+    // when its parameters have actually moved since the last design.
+    void updateMonoChains();
+    void updatePeakFilter();
+    void updateCutFilters();
+
+    // How many samples the smoothed chain runs between working out its
+    // coefficients from the smoothed parameters; set by CONTROL_RATE.
+    int getControlRateDivisor() const;
+
+    // The rate the filters are designed for and run at, i.e. the host rate
+    // times the oversampling factor.
+    double getProcessingSampleRate() const;
+
+    PeakSettings getPeakSettings() const;
+    CutSettings getLowCutSettings() const;
+    CutSettings getHighCutSettings() const;
+
+    // Message thread only. The coefficients the audio thread last designed,
+    // whichever mode is running; a version of 0 means none have been yet.
+    const CoefficientSnapshot& getCoefficientSnapshot();
+
+    // Recent processBlock timings, readable from any thread.
+    const DspLoadMeter& getDspLoadMeter() const { return dspLoadMeter; }
+
+    // The input and output for the spectrum analyzer, only fed while one is
+    // attached.
+    AnalyzerTap& getAnalyzerTap() { return analyzerTap; }
 
 private:
     juce::AudioParameterFloat* lowCutFreq{ nullptr };
@@ -89,20 +129,138 @@ private:
     juce::AudioParameterFloat* peakFreq{ nullptr };
     juce::AudioParameterFloat* peakGain{ nullptr };
     juce::AudioParameterFloat* peakQuality{ nullptr };
+    juce::AudioParameterBool* smoothing{ nullptr };
+    juce::AudioParameterChoice* oversampling{ nullptr };
+    juce::AudioParameterBool* linearPhase{ nullptr };
+    juce::AudioParameterChoice* controlRate{ nullptr };
 
-    MonoChain leftChain, rightChain;
+    // The CONTROL_RATE choices, in samples.
+    static constexpr std::array<int, 4> controlRateDivisors{ 1, 4, 16, 64 };
 
-    void setCutFilterParams(CutFilter& filterChain,
-                         juce::ReferenceCountedArray<juce::dsp::IIR::Coefficients<float>>& cutCoefficients,
-                         int numFilters);
+    // The oversampling choices are 1x, 2x and 4x.
+    static constexpr int maxOversamplingOrder = 2;
 
-    template<int Index, typename CoefficientType>
-    void updateAndEnableFilter(CutFilter& filterChain, CoefficientType& coefficients)
+    // One set per processing precision, so a host rendering in 64 bits runs the
+    // double versions natively instead of converting. Every channel runs
+    // through the one processingChain cascade; see SIMDFilterChain.
+    template <typename SampleType>
+    struct Engines
     {
-        *filterChain.get<Index>().coefficients = *coefficients[Index];
-        filterChain.setBypassed<Index>(false);
+        SIMDFilterChain<SampleType> processingChain;
+        SmoothedFilterChain<SampleType> smoothedChain;
+
+        // One per factor above 1x, created in prepareToPlay.
+        std::array<std::unique_ptr<juce::dsp::Oversampling<SampleType>>, maxOversamplingOrder> oversamplers;
+    };
+
+    Engines<float> floatEngines;
+    Engines<double> doubleEngines;
+
+    template <typename SampleType>
+    Engines<SampleType>& getEngines()
+    {
+        if constexpr (std::is_same_v<SampleType, float>)
+            return floatEngines;
+        else
+            return doubleEngines;
     }
 
+    template <typename SampleType>
+    void processSamples(juce::AudioBuffer<SampleType>& buffer);
+
+    template <typename SampleType>
+    void prepareOversamplers(Engines<SampleType>& engines);
+
+    // Prepares every chain for the current oversampling factor and redesigns
+    // the filters for its rate. Never called on the audio thread.
+    void prepareFilterChains();
+
+    // Reports the delay of whichever mode is running.
+    void updateLatency();
+
+    int maximumBlockSize{ 0 };
+
+    // The factor the chains are prepared for. Outside prepareToPlay it only
+    // changes on the message thread, with processing suspended.
+    std::atomic<int> oversamplingOrder{ 0 };
+
+    // Worked out from the pole radii whenever a band is redesigned, and read
+    // by the host from any thread.
+    std::atomic<double> tailLengthSeconds{ 0.0 };
+
+    // Message thread only. What the host was last told about, and how far the
+    // tail has to move from it, relative to the longer of the two, before the
+    // host is told again.
+    double reportedTailLengthSeconds{ 0.0 };
+    static constexpr double tailChangeThreshold = 0.1;
+    static constexpr int tailCheckIntervalMs = 500;
+
+    bool wasSmoothing{ false };
+
+    // Whether processBlock runs the linear phase filter. Like
+    // oversamplingOrder, it only changes outside prepareToPlay on the message
+    // thread, and only once the kernel has loaded.
+    std::atomic<bool> linearPhaseActive{ false };
+
+    juce::Atomic<bool> lowCutDirty{ true };
+    juce::Atomic<bool> peakDirty{ true };
+    juce::Atomic<bool> highCutDirty{ true };
+
+    // The settings each band of the processing chains was last designed from.
+    PeakSettings appliedPeakSettings;
+    CutSettings appliedLowCutSettings, appliedHighCutSettings;
+
+    // One per oversampling factor, each shared with every other instance
+    // running at that rate. prepareToPlay swaps them with std::atomic_store,
+    // so updateMonoChain can pick one up from any thread.
+    std::array<std::shared_ptr<const CutFilterTable>, maxOversamplingOrder + 1> cutFilterTables;
+
+    // Scratch space for the cut table lookups, so nothing is allocated per block.
+    CutCoefficients cutCoefficients;
+
+    // The audio thread's copy of what the processing chains hold, published
+    // through the triple buffer after each update that changed something.
+    CoefficientSnapshot activeCoefficients;
+    bool coefficientsChanged{ false };
+    TripleBuffer<CoefficientSnapshot> coefficientSnapshots;
+
+    DspLoadMeter dspLoadMeter;
+    AnalyzerTap analyzerTap;
+
+    // A unity gain peak, or a cut at the very end of its range, is dropped
+    // from the cascade altogether.
+    bool isNeutral(const PeakSettings& settings) const;
+    bool isLowCutNeutral(const CutSettings& settings) const;
+    bool isHighCutNeutral(const CutSettings& settings) const;
+
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+
+    // Applies an oversampling or linear phase change on the message thread.
+    void handleAsyncUpdate() override;
+
+    void invalidateFilters();
+    void updateTailLength();
+
+    // Tells the host when the tail length has moved. Polled on the message
+    // thread, as posting a message from the audio thread can lock.
+    void timerCallback() override;
+
+    // For the telemetry export; called on its thread.
+    juce::StringArray getParameterNames() const;
+    void fillTelemetry(Telemetry::Snapshot& snapshot) const;
+
+    Telemetry::Registration telemetry{ getParameterNames(), [this](Telemetry::Snapshot& snapshot)
+    {
+        fillTelemetry(snapshot);
+    } };
+
+    // Last, so its design thread is stopped before anything it reads is destroyed.
+    LinearPhaseFilter linearPhaseFilter{ [this](FilterCascade<float>& cascade)
+    {
+        updateMonoChain(cascade);
+        return getProcessingSampleRate();
+    } };
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimpleEQAudioProcessor)
 };
@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.cpp
+    Created: 18 Oct 2026 9:12:48pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafety.h"
+
+#if SIMPLEEQ_RT_SAFETY_CHECKS
+
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+#if JUCE_LINUX
+ #include <dlfcn.h>
+ #include <pthread.h>
+
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void* __libc_memalign(size_t, size_t);
+    void __libc_free(void*);
+}
+
+ // Initial exec, so reading it never allocates dynamic TLS from inside malloc
+ // when the plugin is loaded with dlopen.
+ #define SIMPLEEQ_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+ #define SIMPLEEQ_TLS_MODEL
+#endif
+
+namespace
+{
+    // How many realtime sections this thread is inside.
+    thread_local int realtimeDepth SIMPLEEQ_TLS_MODEL = 0;
+
+    std::atomic<int> numViolations{ 0 };
+
+    void checkRealtimeSafe(const char* operation)
+    {
+        if (realtimeDepth <= 0)
+            return;
+
+        // Reporting allocates, so the checks are off until it's done.
+        auto depth = std::exchange(realtimeDepth, 0);
+
+        numViolations++;
+
+        juce::Logger::outputDebugString(juce::String("Real-time safety violation: ") + operation
+                                        + " on the audio thread\n" + juce::SystemStats::getStackBacktrace());
+        jassertfalse;
+
+        realtimeDepth = depth;
+    }
+}
+
+namespace RealtimeSafety
+{
+    ScopedRealtimeSection::ScopedRealtimeSection() noexcept
+    {
+        ++realtimeDepth;
+    }
+
+    ScopedRealtimeSection::~ScopedRealtimeSection() noexcept
+    {
+        --realtimeDepth;
+    }
+
+    int getNumViolations() noexcept
+    {
+        return numViolations.load();
+    }
+}
+
+#if JUCE_LINUX
+
+// libstdc++'s operator new and delete go through these, so they're caught too.
+extern "C"
+{
+    void* malloc(size_t size)
+    {
+        checkRealtimeSafe("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+        checkRealtimeSafe("calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, size_t size)
+    {
+        checkRealtimeSafe("realloc");
+        return __libc_realloc(ptr, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size)
+    {
+        checkRealtimeSafe("aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** ptr, size_t alignment, size_t size)
+    {
+        checkRealtimeSafe("posix_memalign");
+
+        if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+            return EINVAL;
+
+        *ptr = __libc_memalign(alignment, size);
+        return *ptr != nullptr || size == 0 ? 0 : ENOMEM;
+    }
+
+    void free(void* ptr)
+    {
+        if (ptr != nullptr)
+            checkRealtimeSafe("free");
+
+        __libc_free(ptr);
+    }
+
+    int pthread_mutex_lock(pthread_mutex_t* mutex)
+    {
+        // Constant initialised, so there's no static guard, which could itself
+        // take a mutex.
+        using LockFunction = int (*)(pthread_mutex_t*);
+        static std::atomic<LockFunction> realLock{ nullptr };
+
+        auto lock = realLock.load(std::memory_order_relaxed);
+
+        if (lock == nullptr)
+        {
+            lock = reinterpret_cast<LockFunction>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+            realLock.store(lock, std::memory_order_relaxed);
+        }
+
+        checkRealtimeSafe("pthread_mutex_lock");
+        return lock(mutex);
+    }
+}
+
+#else
+
+// The default nothrow and array forms all end up in these two.
+void* operator new(std::size_t size)
+{
+    checkRealtimeSafe("operator new");
+
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+        checkRealtimeSafe("operator delete");
+
+    std::free(ptr);
+}
+
+#endif
+
+#else
+
+namespace RealtimeSafety
+{
+    int getNumViolations() noexcept
+    {
+        return 0;
+    }
+}
+
+#endif
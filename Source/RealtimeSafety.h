@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.h
+    Created: 18 Oct 2026 9:12:48pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef SIMPLEEQ_RT_SAFETY_CHECKS
+ #define SIMPLEEQ_RT_SAFETY_CHECKS 0
+#endif
+
+// A debug mode that traps allocations and locks on the audio thread.
+//
+// With SIMPLEEQ_RT_SAFETY_CHECKS set to 1, any allocation, free or mutex lock
+// made while a ScopedRealtimeSection is alive on the calling thread is logged
+// with a stack trace, counted and hits a jassert. On Linux malloc, calloc,
+// realloc, free, the aligned allocators and pthread_mutex_lock are all
+// interposed; elsewhere only the global operator new and delete are replaced.
+//
+// Set to 0, the default, none of this is compiled in.
+namespace RealtimeSafety
+{
+    class ScopedRealtimeSection
+    {
+    public:
+       #if SIMPLEEQ_RT_SAFETY_CHECKS
+        ScopedRealtimeSection() noexcept;
+        ~ScopedRealtimeSection() noexcept;
+       #else
+        ScopedRealtimeSection() noexcept {}
+       #endif
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedRealtimeSection)
+    };
+
+    // Violations so far, across all threads. Always 0 with the checks off.
+    int getNumViolations() noexcept;
+}
@@ -37,65 +37,28 @@ void ResponseCurveComponent::paint(juce::Graphics& g)
 {
     using namespace juce;
 
-    auto width = getWidth();
-
-    auto& lowCut = monoChain.get<ChainPositions::LOW_CUT_FILTER>();
-    auto& peakFilter = monoChain.get<ChainPositions::PEAK_FILTER>();
-    auto& highCut = monoChain.get<ChainPositions::HIGH_CUT_FILTER>();
-
-    auto sampleRate = audioProcessor.getSampleRate();
-
-    std::vector<double> magnitudes;
-    magnitudes.resize(width);
-
-    for (int i = 0; i < width; i++)
+    if (spectrumPaths != nullptr)
     {
-        double mag = 1.0;
-        auto freq = mapToLog10<double>(double(i) / double(width), 20.0, 20000.0);
-
-        if (!monoChain.isBypassed<ChainPositions::PEAK_FILTER>())
-            mag *= peakFilter.coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!lowCut.isBypassed<0>())
-            mag *= lowCut.get<0>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!lowCut.isBypassed<1>())
-            mag *= lowCut.get<1>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!lowCut.isBypassed<2>())
-            mag *= lowCut.get<2>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!lowCut.isBypassed<3>())
-            mag *= lowCut.get<3>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!highCut.isBypassed<0>())
-            mag *= highCut.get<0>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!highCut.isBypassed<1>())
-            mag *= highCut.get<1>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!highCut.isBypassed<2>())
-            mag *= highCut.get<2>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-        if (!highCut.isBypassed<3>())
-            mag *= highCut.get<3>().coefficients->getMagnitudeForFrequency(freq, sampleRate);
-
-        magnitudes[i] = Decibels::gainToDecibels(mag);
-    }
-
-    Path responseCurve;
-
-    const double outputMin = getBottom();
-    const double outputMax = getY();
-    auto map = [outputMin, outputMax](double input)
-        {
-            return jmap(input, -27.0, 27.0, outputMin, outputMax);
-        };
-
-    responseCurve.startNewSubPath(getX(), map(magnitudes.front()));
+        g.setColour(Colours::white.withAlpha(0.2f));
+        g.strokePath(spectrumPaths->input, PathStrokeType(1.0));
 
-    for (int i = 1; i < magnitudes.size(); i += 1)
-    {
-        responseCurve.lineTo(getX() + i, map(magnitudes[i]));
+        g.setColour(Colours::skyblue.withAlpha(0.5f));
+        g.strokePath(spectrumPaths->output, PathStrokeType(1.0));
     }
 
     g.setColour(Colours::aquamarine);
     g.drawRoundedRectangle(getLocalBounds().toFloat(), 4.0, 2.0);
 
-    g.setColour(Colours::azure);
-    g.strokePath(responseCurve, PathStrokeType(2.0));
+    // The curve is drawn by the renderer; until a new one is ready after a
+    // resize, the last one is stretched to fit.
+    if (curveImage.isValid())
+        g.drawImage(curveImage, getLocalBounds().toFloat());
+}
+
+void ResponseCurveComponent::resized()
+{
+    analyzer.setDisplaySize(getWidth(), getHeight());
+    requestCurve();
 }
 
 void ResponseCurveComponent::parameterValueChanged(int parameterIndex, float newValue)
@@ -105,9 +68,39 @@ void ResponseCurveComponent::parameterValueChanged(int parameterIndex, float new
 
 void ResponseCurveComponent::timerCallback()
 {
-    if (parametersChanged.compareAndSetBool(false, true))
+    // What the audio thread is actually running, without designing anything.
+    auto& snapshot = audioProcessor.getCoefficientSnapshot();
+
+    if (snapshot.version != snapshotVersion)
+    {
+        applySnapshot(snapshot);
+        requestCurve();
+        parametersChanged.set(false);
+        ticksWithoutSnapshot = 0;
+    }
+
+    // A host that isn't running the plugin publishes nothing, so after a
+    // few ticks the curve follows the parameters by itself.
+    if (parametersChanged.get() && ++ticksWithoutSnapshot >= maxTicksWithoutSnapshot)
     {
+        parametersChanged.set(false);
+        ticksWithoutSnapshot = 0;
         updateChain();
+        requestCurve();
+    }
+
+    // Moving to a display with another scale needs the image drawn again.
+    if (juce::Component::getApproximateScaleFactorForComponent(this) != curveScale)
+        requestCurve();
+
+    auto image = renderer.getImage();
+
+    auto paths = analyzer.getPaths();
+
+    if (image != curveImage || paths != spectrumPaths)
+    {
+        curveImage = image;
+        spectrumPaths = paths;
         repaint();
     }
 }
@@ -115,4 +108,33 @@ void ResponseCurveComponent::timerCallback()
 void ResponseCurveComponent::updateChain()
 {
     audioProcessor.updateMonoChain(monoChain);
+    sampleRate = audioProcessor.getProcessingSampleRate();
+}
+
+void ResponseCurveComponent::applySnapshot(const CoefficientSnapshot& snapshot)
+{
+    monoChain.setPeakCoefficients(snapshot.peak);
+    monoChain.setLowCutCoefficients(snapshot.lowCut);
+    monoChain.setHighCutCoefficients(snapshot.highCut);
+
+    monoChain.setStageEnabled(CascadeStage::Peak, snapshot.peakEnabled);
+    monoChain.setStageEnabled(CascadeStage::LowCut, snapshot.lowCutEnabled);
+    monoChain.setStageEnabled(CascadeStage::HighCut, snapshot.highCutEnabled);
+
+    sampleRate = snapshot.sampleRate;
+    snapshotVersion = snapshot.version;
+}
+
+void ResponseCurveComponent::requestCurve()
+{
+    curveScale = juce::Component::getApproximateScaleFactorForComponent(this);
+
+    ResponseCurveRenderer::Request request;
+    request.chain = monoChain;
+    request.sampleRate = sampleRate;
+    request.width = getWidth();
+    request.height = getHeight();
+    request.scale = curveScale;
+
+    renderer.request(request);
 }
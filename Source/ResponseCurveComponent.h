@@ -12,6 +12,8 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
+#include "ResponseCurveRenderer.h"
+#include "SpectrumAnalyzer.h"
 
 class ResponseCurveComponent : public juce::Component,
     juce::AudioProcessorParameter::Listener,
@@ -24,15 +26,38 @@ public:
     ~ResponseCurveComponent() override;
 
     void paint(juce::Graphics& g) override;
+    void resized() override;
 
     void parameterValueChanged(int parameterIndex, float newValue) override;
     void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override { }
     void timerCallback() override;
 
 private:
+    // Designs the chain here from the parameters, for when the audio thread
+    // isn't publishing anything.
     void updateChain();
+    void applySnapshot(const CoefficientSnapshot& snapshot);
+
+    // Hands the current chain and size to the renderer.
+    void requestCurve();
 
     juce::Atomic<bool> parametersChanged{ false };
 
+    // Timer ticks a parameter change has gone without a new snapshot, and
+    // how many to wait (100 ms at 60 Hz) before designing the curve here.
+    int ticksWithoutSnapshot{ 0 };
+    static constexpr int maxTicksWithoutSnapshot = 6;
+
     MonoChain monoChain;
+    double sampleRate{ 0.0 };
+    juce::uint64 snapshotVersion{ 0 };
+
+    ResponseCurveRenderer renderer;
+    juce::Image curveImage;
+    float curveScale{ 1.f };
+
+    // Drawn behind the curve. The analyzer only exists while the editor
+    // does, so the audio thread feeds it nothing otherwise.
+    SpectrumAnalyzer analyzer{ audioProcessor.getAnalyzerTap() };
+    std::shared_ptr<const SpectrumAnalyzer::Paths> spectrumPaths;
 };
\ No newline at end of file
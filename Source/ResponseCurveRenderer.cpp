@@ -0,0 +1,173 @@
+/*
+  ==============================================================================
+
+    ResponseCurveRenderer.cpp
+    Created: 19 Oct 2026 12:21:08am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "ResponseCurveRenderer.h"
+
+ResponseCurveRenderer::ResponseCurveRenderer()
+    : juce::Thread("Response curve")
+{
+    startThread();
+}
+
+ResponseCurveRenderer::~ResponseCurveRenderer()
+{
+    stopThread(1000);
+}
+
+void ResponseCurveRenderer::request(const Request& newRequest)
+{
+    {
+        const juce::ScopedLock sl(lock);
+
+        pendingRequest = newRequest;
+        pendingVersion.fetch_add(1);
+    }
+
+    notify();
+}
+
+juce::Image ResponseCurveRenderer::getImage() const
+{
+    const juce::ScopedLock sl(lock);
+    return finishedImage;
+}
+
+void ResponseCurveRenderer::run()
+{
+    while (!threadShouldExit())
+    {
+        if (pendingVersion.load() == renderedVersion)
+        {
+            wait(-1);
+            continue;
+        }
+
+        Request job;
+        juce::uint64 version;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            job = pendingRequest;
+            version = pendingVersion.load();
+        }
+
+        auto image = render(job, version);
+
+        if (image.isValid())
+        {
+            const juce::ScopedLock sl(lock);
+            finishedImage = image;
+        }
+
+        renderedVersion = version;
+    }
+}
+
+bool ResponseCurveRenderer::isStale(juce::uint64 version) const
+{
+    return pendingVersion.load(std::memory_order_relaxed) != version || threadShouldExit();
+}
+
+juce::Image ResponseCurveRenderer::render(const Request& job, juce::uint64 version)
+{
+    using namespace juce;
+
+    // Nothing to draw before the processor has been given a sample rate.
+    auto width = job.sampleRate > 0.0 ? jmax(0, job.width) : 0;
+
+    if (width == 0 || job.height <= 0)
+        return {};
+
+    if (grid.getNumPoints() != width || gridSampleRate != job.sampleRate)
+    {
+        std::vector<double> frequencies(static_cast<size_t>(width));
+
+        for (int i = 0; i < width; i++)
+            frequencies[i] = mapToLog10<double>(double(i) / double(width), 20.0, 20000.0);
+
+        grid.setFrequencies(frequencies.data(), width, job.sampleRate);
+        gridSampleRate = job.sampleRate;
+
+        for (auto& band : bandCurves)
+        {
+            band.decibels.resize(static_cast<size_t>(width));
+            band.numSections = -1;
+        }
+    }
+
+    auto& layout = job.chain.getLayout();
+
+    for (int stage = 0; stage < MonoChain::numStages; stage++)
+    {
+        if (isStale(version))
+            return {};
+
+        auto& band = bandCurves[stage];
+
+        auto numSections = layout.getNumSections(static_cast<CascadeStage>(stage));
+        auto* sections = job.chain.getSections() + layout.getFirstSection(static_cast<CascadeStage>(stage));
+
+        if (numSections == band.numSections && std::equal(sections, sections + numSections, band.sections.begin()))
+            continue;
+
+        // Left marked out of date until the curve is whole again.
+        band.numSections = -1;
+
+        FrequencyResponse response;
+        response.magnitudes = band.decibels.data();
+        job.chain.getFrequencyResponse(static_cast<CascadeStage>(stage), grid, response);
+
+        for (auto& value : band.decibels)
+            value = Decibels::gainToDecibels(value);
+
+        std::copy(sections, sections + numSections, band.sections.begin());
+        band.numSections = numSections;
+    }
+
+    Path responseCurve;
+    responseCurve.preallocateSpace(width * 3);
+
+    const double outputMin = job.height;
+    const double outputMax = 0.0;
+    auto map = [outputMin, outputMax](double input)
+        {
+            return jmap(input, -27.0, 27.0, outputMin, outputMax);
+        };
+
+    for (int i = 0; i < width; i++)
+    {
+        double decibels = 0.0;
+
+        for (auto& band : bandCurves)
+            decibels += band.decibels[i];
+
+        if (i == 0)
+            responseCurve.startNewSubPath(0.f, static_cast<float>(map(decibels)));
+        else
+            responseCurve.lineTo(static_cast<float>(i), static_cast<float>(map(decibels)));
+    }
+
+    if (isStale(version))
+        return {};
+
+    Image image(Image::ARGB,
+                jmax(1, roundToInt(job.width * job.scale)),
+                jmax(1, roundToInt(job.height * job.scale)),
+                true);
+
+    Graphics g(image);
+    g.addTransform(AffineTransform::scale(job.scale));
+
+    g.setColour(Colours::azure);
+    g.strokePath(responseCurve, PathStrokeType(2.0));
+
+    return image;
+}
@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    ResponseCurveRenderer.h
+    Created: 19 Oct 2026 12:21:08am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+// Draws the response curve into an image on a background thread, so all
+// the message thread does is swap in the finished image and blit it.
+//
+// Each request carries a copy of the chain to draw. The worker always takes
+// the newest request: requests that come in faster than it can draw are
+// coalesced rather than queued, and a render is dropped between steps as
+// soon as a newer request lands, so a fast knob drag never builds up a
+// backlog. It keeps one curve per band between renders and only works out
+// again the bands whose sections changed.
+class ResponseCurveRenderer : private juce::Thread
+{
+public:
+    struct Request
+    {
+        MonoChain chain;
+        double sampleRate{ 0.0 };
+
+        // In logical pixels, drawn at scale physical pixels to each.
+        int width{ 0 };
+        int height{ 0 };
+        float scale{ 1.f };
+    };
+
+    ResponseCurveRenderer();
+    ~ResponseCurveRenderer() override;
+
+    // Supersedes any request that hasn't finished yet.
+    void request(const Request& newRequest);
+
+    // The most recently finished image, which is never drawn to again.
+    // Invalid until the first one is done.
+    juce::Image getImage() const;
+
+private:
+    // One band's share of the response in decibels, a value per pixel, and
+    // the sections it was worked out from.
+    struct BandCurve
+    {
+        std::array<MonoChain::Coefficients, MonoChain::maxCutSections> sections;
+        int numSections{ -1 };
+        std::vector<double> decibels;
+    };
+
+    void run() override;
+
+    // Returns an invalid image if a newer request came in along the way.
+    juce::Image render(const Request& job, juce::uint64 version);
+    bool isStale(juce::uint64 version) const;
+
+    juce::CriticalSection lock;
+    Request pendingRequest;
+    std::atomic<juce::uint64> pendingVersion{ 0 };
+    juce::Image finishedImage;
+
+    // Only touched by the worker.
+    juce::uint64 renderedVersion{ 0 };
+    ResponseGrid grid;
+    double gridSampleRate{ 0.0 };
+    std::array<BandCurve, MonoChain::numStages> bandCurves;
+};
@@ -28,11 +28,31 @@ void LookAndFeel::drawRotarySlider(juce::Graphics& g,
 
     auto bounds = Rectangle<float>(x, y, width, height);
 
+    drawRotarySliderBody(g, bounds);
+    drawRotarySliderValue(g, bounds, sliderPosProportional, rotaryStartAngle, rotaryEndAngle, *rswl);
+}
+
+void LookAndFeel::drawRotarySliderBody(juce::Graphics& g, juce::Rectangle<float> bounds)
+{
+    using namespace juce;
+
     g.setColour(Colours::azure);
     g.fillEllipse(bounds);
 
     g.setColour(findColour(juce::ResizableWindow::backgroundColourId));
     g.drawEllipse(bounds, 1.f);
+}
+
+void LookAndFeel::drawRotarySliderValue(juce::Graphics& g,
+                                        juce::Rectangle<float> bounds,
+                                        float sliderPosProportional,
+                                        float rotaryStartAngle,
+                                        float rotaryEndAngle,
+                                        RotarySliderWithLabels& rswl)
+{
+    using namespace juce;
+
+    g.setColour(findColour(juce::ResizableWindow::backgroundColourId));
 
     Path p;
 
@@ -52,12 +72,12 @@ void LookAndFeel::drawRotarySlider(juce::Graphics& g,
 
     g.fillPath(p);
 
-    g.setFont(rswl->getTextHeight());
-    auto text = rswl->getDisplayString();
-    auto strWidth = g.getCurrentFont().getStringWidth(text);
-    
+    g.setFont(rswl.getTextHeight());
+    auto text = rswl.getDisplayString();
+    auto strWidth = rswl.getDisplayStringWidth();
+
     Rectangle<float> textBounds;
-    textBounds.setSize(strWidth + 8, rswl->getTextHeight() + 4);
+    textBounds.setSize(strWidth + 8, rswl.getTextHeight() + 4);
     textBounds.setCentre(bounds.getCentre());
 
     g.fillRoundedRectangle(textBounds, 4.f);
@@ -72,8 +92,12 @@ RotarySliderWithLabels::RotarySliderWithLabels(juce::RangedAudioParameter& param
     : juce::Slider(juce::Slider::SliderStyle::RotaryHorizontalVerticalDrag,
                    juce::Slider::TextEntryBoxPosition::NoTextBox),
     param(&param),
+    choiceParam(dynamic_cast<juce::AudioParameterChoice*>(&param)),
     suffix(unitSuffix)
 {
+    // Anything else needs its own formatting in updateDisplayString.
+    jassert(choiceParam != nullptr || dynamic_cast<juce::AudioParameterFloat*>(&param) != nullptr);
+
     setLookAndFeel(&lnf);
 }
 
@@ -93,15 +117,48 @@ void RotarySliderWithLabels::paint(juce::Graphics& g)
 
     auto sliderBounds = getSliderBounds();
 
-    getLookAndFeel().drawRotarySlider(g,
-                                      sliderBounds.getX(),
-                                      sliderBounds.getY(),
-                                      sliderBounds.getWidth(),
-                                      sliderBounds.getHeight(),
-                                      jmap(getValue(), range.getStart(), range.getEnd(), 0.0, 1.0),
-                                      startAngle,
-                                      endAngle,
-                                      *this);
+    // Everything but the indicator and value text comes from the cache.
+    updateStaticImage(g.getInternalContext().getPhysicalPixelScaleFactor(), startAngle, endAngle);
+    g.drawImage(staticImage, getLocalBounds().toFloat());
+
+    lnf.drawRotarySliderValue(g,
+                              sliderBounds.toFloat(),
+                              static_cast<float>(jmap(getValue(), range.getStart(), range.getEnd(), 0.0, 1.0)),
+                              startAngle,
+                              endAngle,
+                              *this);
+
+    // Draws bounding boxes for reference
+    /*g.setColour(Colours::red);
+    g.drawRect(getLocalBounds());
+    g.setColour(Colours::yellow);
+    g.drawRect(sliderBounds);*/
+}
+
+void RotarySliderWithLabels::updateStaticImage(float scale, float startAngle, float endAngle)
+{
+    using namespace juce;
+
+    auto bounds = getLocalBounds();
+
+    if (staticImage.isValid() && bounds == staticImageBounds && scale == staticImageScale && labels.size() == staticImageNumLabels)
+        return;
+
+    staticImageBounds = bounds;
+    staticImageScale = scale;
+    staticImageNumLabels = labels.size();
+
+    staticImage = Image(Image::ARGB,
+                        jmax(1, roundToInt(bounds.getWidth() * scale)),
+                        jmax(1, roundToInt(bounds.getHeight() * scale)),
+                        true);
+
+    Graphics g(staticImage);
+    g.addTransform(AffineTransform::scale(scale));
+
+    auto sliderBounds = getSliderBounds();
+
+    lnf.drawRotarySliderBody(g, sliderBounds.toFloat());
 
     auto center = sliderBounds.toFloat().getCentre();
     auto radius = sliderBounds.getWidth() * 0.5f;
@@ -127,12 +184,6 @@ void RotarySliderWithLabels::paint(juce::Graphics& g)
 
         g.drawFittedText(str, textBounds.toNearestInt(), Justification::centred, 1);
     }
-
-    // Draws bounding boxes for reference
-    /*g.setColour(Colours::red);
-    g.drawRect(getLocalBounds());
-    g.setColour(Colours::yellow);
-    g.drawRect(sliderBounds);*/
 }
 
 juce::Rectangle<int> RotarySliderWithLabels::getSliderBounds() const
@@ -157,43 +208,54 @@ int RotarySliderWithLabels::getTextHeight() const
 
 juce::String RotarySliderWithLabels::getDisplayString() const
 {
-    if (auto* choiceParam = dynamic_cast<juce::AudioParameterChoice*>(param))
-    {
-        auto str = choiceParam->getCurrentChoiceName();
-        str << " ";
-        str << suffix;
-        return str;
-    }
+    updateDisplayString();
+    return displayString;
+}
 
-    juce::String str;
-    bool addK = false;
+float RotarySliderWithLabels::getDisplayStringWidth() const
+{
+    updateDisplayString();
+    return displayStringWidth;
+}
 
-    juce::AudioParameterFloat* floatParam;
-    if (!(floatParam = dynamic_cast<juce::AudioParameterFloat*>(param)))
-    {
-        jassertfalse;
-    }
+void RotarySliderWithLabels::updateDisplayString() const
+{
+    auto value = getValue();
 
-    float val = getValue();
-    if (val >= 1000.f)
-    {
-        val /= 1000.f;
-        addK = true;
-    }
+    if (value == displayValue)
+        return;
 
-    str = juce::String(val, addK ? 2 : 0);
+    displayValue = value;
 
-    if (suffix.isEmpty())
+    if (choiceParam != nullptr)
     {
-        return str;
+        displayString = choiceParam->getCurrentChoiceName();
+        displayString << " ";
+        displayString << suffix;
     }
-
-    str << " ";
-    if (addK)
+    else
     {
-        str << "k";
+        bool addK = false;
+
+        float val = static_cast<float>(value);
+        if (val >= 1000.f)
+        {
+            val /= 1000.f;
+            addK = true;
+        }
+
+        displayString = juce::String(val, addK ? 2 : 0);
+
+        if (suffix.isNotEmpty())
+        {
+            displayString << " ";
+            if (addK)
+            {
+                displayString << "k";
+            }
+            displayString << suffix;
+        }
     }
-    str << suffix;
 
-    return str;
+    displayStringWidth = static_cast<float>(juce::Font(static_cast<float>(getTextHeight())).getStringWidth(displayString));
 }
@@ -12,6 +12,8 @@
 
 #include <JuceHeader.h>
 
+class RotarySliderWithLabels;
+
 class LookAndFeel : public juce::LookAndFeel_V4
 {
 public:
@@ -21,6 +23,17 @@ public:
                           float rotaryStartAngle,
                           float rotaryEndAngle,
                           juce::Slider&) override;
+
+    // drawRotarySlider in two halves: the body and ring, which never change
+    // and are cached by RotarySliderWithLabels, and the indicator and value
+    // text drawn over them.
+    void drawRotarySliderBody(juce::Graphics&, juce::Rectangle<float> bounds);
+    void drawRotarySliderValue(juce::Graphics&,
+                               juce::Rectangle<float> bounds,
+                               float sliderPosProportional,
+                               float rotaryStartAngle,
+                               float rotaryEndAngle,
+                               RotarySliderWithLabels&);
 };
 
 class RotarySliderWithLabels : public juce::Slider
@@ -34,6 +47,9 @@ public:
     int getTextHeight() const;
     juce::String getDisplayString() const;
 
+    // The display string's width in the value font, measured along with it.
+    float getDisplayStringWidth() const;
+
     struct LabelPos
     {
         float pos;
@@ -43,8 +59,24 @@ public:
     juce::Array<LabelPos> labels;
 
 private:
+    // Draws the body, ring and range labels into staticImage, if the size,
+    // scale or labels have changed since it was last drawn.
+    void updateStaticImage(float scale, float startAngle, float endAngle);
+    void updateDisplayString() const;
+
     LookAndFeel lnf;
 
     juce::RangedAudioParameter* param;
+    juce::AudioParameterChoice* choiceParam{ nullptr };
     juce::String suffix;
+
+    juce::Image staticImage;
+    juce::Rectangle<int> staticImageBounds;
+    float staticImageScale{ 0.f };
+    int staticImageNumLabels{ -1 };
+
+    // The display string for the value it was last worked out for.
+    mutable double displayValue{ std::numeric_limits<double>::quiet_NaN() };
+    mutable juce::String displayString;
+    mutable float displayStringWidth{ 0.f };
 };
\ No newline at end of file
@@ -0,0 +1,330 @@
+/*
+  ==============================================================================
+
+    SIMDFilterChain.cpp
+    Created: 18 Oct 2026 2:31:18pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "SIMDFilterChain.h"
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.numChannels <= maxChannels);
+
+    numChannels = juce::jmin(static_cast<size_t>(spec.numChannels), maxChannels);
+
+    groupStates.resize((numChannels + numLanes - 1) / numLanes);
+
+    maximumBlockSize = juce::jmax(static_cast<size_t>(1), static_cast<size_t>(spec.maximumBlockSize));
+
+   #if JUCE_USE_SIMD
+    interleaved.resize(maximumBlockSize);
+   #endif
+
+    dry.resize(maximumBlockSize);
+
+    for (auto& gains : fadeGains)
+        gains.resize(maximumBlockSize);
+
+    for (auto& fade : fades)
+        fade.reset(spec.sampleRate, fadeLengthSeconds);
+
+    reset();
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::reset()
+{
+    // Any stage still fading jumps straight to where it was heading.
+    for (int stage = 0; stage < numStages; stage++)
+        fades[stage].setCurrentAndTargetValue(fades[stage].getTargetValue());
+
+    removeFadedOutStages();
+    clearState();
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::clearState()
+{
+    for (auto& state : groupStates)
+    {
+        state.state1.fill(broadcast(0));
+        state.state2.fill(broadcast(0));
+    }
+
+    stateIsSilent = true;
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::setLowCutCoefficients(const CutCoefficients& coefficients)
+{
+    auto previousLayout = cascade.getLayout();
+    cascade.setLowCutCoefficients(coefficients);
+    relayoutState(previousLayout);
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::setPeakCoefficients(const CoefficientArray& coefficients)
+{
+    cascade.setPeakCoefficients(coefficients);
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::setHighCutCoefficients(const CutCoefficients& coefficients)
+{
+    auto previousLayout = cascade.getLayout();
+    cascade.setHighCutCoefficients(coefficients);
+    relayoutState(previousLayout);
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::setStageEnabled(Stage stage, bool shouldBeEnabled)
+{
+    auto& fade = fades[stage];
+
+    if (shouldBeEnabled)
+    {
+        if (!cascade.isStageEnabled(stage))
+        {
+            auto previousLayout = cascade.getLayout();
+            cascade.setStageEnabled(stage, true);
+            relayoutState(previousLayout);
+
+            fade.setCurrentAndTargetValue(0);
+        }
+
+        fade.setTargetValue(1);
+    }
+    else if (cascade.isStageEnabled(stage))
+    {
+        fade.setTargetValue(0);
+    }
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::process(const juce::dsp::ProcessContextReplacing<SampleType>& context)
+{
+    auto& block = context.getOutputBlock();
+    auto numSamples = block.getNumSamples();
+
+    // Nothing to process into before prepare.
+    if (maximumBlockSize == 0)
+        return;
+
+    // The scratch buffers only hold the prepared block size, and some hosts
+    // send more than they announced.
+    for (size_t start = 0; start < numSamples; start += maximumBlockSize)
+    {
+        auto chunk = block.getSubBlock(start, juce::jmin(maximumBlockSize, numSamples - start));
+        processChunk(chunk);
+    }
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::processChunk(juce::dsp::AudioBlock<SampleType>& block)
+{
+    auto numSamples = block.getNumSamples();
+    auto numChannelsInBlock = juce::jmin(block.getNumChannels(), numChannels);
+
+    auto isFading = advanceFades(numSamples);
+
+    // A fully neutral chain passes the block through as it is.
+    if (cascade.getNumSections() == 0 && !isFading)
+        return;
+
+    // Nothing is ringing and nothing new is coming in, so the output would be
+    // silence too. The leftover state is cleared so it can't resurface later.
+    if (stateIsSilent && isBelowNoiseFloor(block))
+    {
+        if (isFading)
+            removeFadedOutStages();
+
+        clearState();
+        return;
+    }
+
+    for (size_t group = 0; group * numLanes < numChannelsInBlock; group++)
+    {
+        auto firstChannel = group * numLanes;
+
+       #if JUCE_USE_SIMD
+        auto numChannelsInGroup = juce::jmin(numLanes, numChannelsInBlock - firstChannel);
+
+        interleave(block, firstChannel, numChannelsInGroup);
+        processGroup(interleaved.data(), numSamples, groupStates[group]);
+        deinterleave(block, firstChannel, numChannelsInGroup);
+       #else
+        processGroup(block.getChannelPointer(firstChannel), numSamples, groupStates[group]);
+       #endif
+    }
+
+    if (isFading)
+        removeFadedOutStages();
+
+    stateIsSilent = isStateBelowNoiseFloor();
+}
+
+template <typename SampleType>
+bool SIMDFilterChain<SampleType>::isBelowNoiseFloor(const juce::dsp::AudioBlock<SampleType>& block) const
+{
+    auto range = block.findMinAndMax();
+
+    return juce::jmax(-range.getStart(), range.getEnd()) < static_cast<SampleType>(noiseFloor);
+}
+
+template <typename SampleType>
+bool SIMDFilterChain<SampleType>::isStateBelowNoiseFloor() const
+{
+    // Only the active sections; anything past them is left over from an earlier layout.
+    auto numValuesPerState = static_cast<size_t>(cascade.getNumSections()) * numLanes;
+
+    for (auto& state : groupStates)
+    {
+        for (auto* values : { reinterpret_cast<const SampleType*>(state.state1.data()),
+                              reinterpret_cast<const SampleType*>(state.state2.data()) })
+        {
+            for (size_t i = 0; i < numValuesPerState; i++)
+                if (std::abs(values[i]) >= static_cast<SampleType>(noiseFloor))
+                    return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename SampleType>
+bool SIMDFilterChain<SampleType>::advanceFades(size_t numSamples)
+{
+    auto isFading = false;
+
+    // Every group sees the same ramp, so the gains are worked out once per block.
+    for (int stage = 0; stage < numStages; stage++)
+    {
+        auto& fade = fades[stage];
+        stageIsFading[stage] = fade.isSmoothing();
+
+        if (!stageIsFading[stage])
+            continue;
+
+        for (size_t i = 0; i < numSamples; i++)
+            fadeGains[stage][i] = fade.getNextValue();
+
+        isFading = true;
+    }
+
+    return isFading;
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::removeFadedOutStages()
+{
+    for (int stage = 0; stage < numStages; stage++)
+    {
+        auto& fade = fades[stage];
+
+        if (fade.isSmoothing() || fade.getTargetValue() > 0 || !cascade.isStageEnabled(static_cast<Stage>(stage)))
+            continue;
+
+        auto previousLayout = cascade.getLayout();
+        cascade.setStageEnabled(static_cast<Stage>(stage), false);
+        relayoutState(previousLayout);
+    }
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::processGroup(Vector* samples, size_t numSamples, GroupState& state)
+{
+    auto* state1 = state.state1.data();
+    auto* state2 = state.state2.data();
+    auto& layout = cascade.getLayout();
+
+    for (int stage = 0; stage < numStages; stage++)
+    {
+        auto firstSection = layout.getFirstSection(static_cast<Stage>(stage));
+        auto endSection = firstSection + layout.getNumSections(static_cast<Stage>(stage));
+
+        if (!stageIsFading[stage])
+        {
+            cascade.processSections(samples, numSamples, state1, state2, firstSection, endSection);
+            continue;
+        }
+
+        std::copy(samples, samples + numSamples, dry.begin());
+        cascade.processSections(samples, numSamples, state1, state2, firstSection, endSection);
+
+        auto& gains = fadeGains[stage];
+
+        for (size_t i = 0; i < numSamples; i++)
+            samples[i] = dry[i] + (samples[i] - dry[i]) * gains[i];
+    }
+}
+
+template <typename SampleType>
+typename SIMDFilterChain<SampleType>::Vector SIMDFilterChain<SampleType>::broadcast(SampleType value)
+{
+   #if JUCE_USE_SIMD
+    return Vector::expand(value);
+   #else
+    return value;
+   #endif
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::relayoutState(const Layout& previousLayout)
+{
+    auto& layout = cascade.getLayout();
+
+    if (layout == previousLayout)
+        return;
+
+    for (auto& state : groupStates)
+    {
+        FilterCascade<SampleType>::relayoutState(state.state1, previousLayout, layout, broadcast(0));
+        FilterCascade<SampleType>::relayoutState(state.state2, previousLayout, layout, broadcast(0));
+    }
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::interleave(const juce::dsp::AudioBlock<SampleType>& block, size_t firstChannel, size_t numChannelsInGroup)
+{
+    auto numSamples = block.getNumSamples();
+    auto* raw = reinterpret_cast<SampleType*>(interleaved.data());
+
+    for (size_t lane = 0; lane < numLanes; lane++)
+    {
+        if (lane < numChannelsInGroup)
+        {
+            auto* source = block.getChannelPointer(firstChannel + lane);
+
+            for (size_t i = 0; i < numSamples; i++)
+                raw[i * numLanes + lane] = source[i];
+        }
+        else
+        {
+            for (size_t i = 0; i < numSamples; i++)
+                raw[i * numLanes + lane] = 0;
+        }
+    }
+}
+
+template <typename SampleType>
+void SIMDFilterChain<SampleType>::deinterleave(juce::dsp::AudioBlock<SampleType>& block, size_t firstChannel, size_t numChannelsInGroup) const
+{
+    auto numSamples = block.getNumSamples();
+    auto* raw = reinterpret_cast<const SampleType*>(interleaved.data());
+
+    for (size_t lane = 0; lane < numChannelsInGroup; lane++)
+    {
+        auto* dest = block.getChannelPointer(firstChannel + lane);
+
+        for (size_t i = 0; i < numSamples; i++)
+            dest[i] = raw[i * numLanes + lane];
+    }
+}
+
+template class SIMDFilterChain<float>;
+template class SIMDFilterChain<double>;
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    SIMDFilterChain.h
+    Created: 18 Oct 2026 2:31:18pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FilterCascade.h"
+
+// Runs a FilterCascade over any number of channels, with the channels
+// interleaved into the lanes of a juce::dsp::SIMDRegister so one recursion
+// filters a whole group of channels at once. SIMDRegister is 128 bits on both
+// SSE and NEON, so that's 4 channels per register in float and 2 in double.
+// Channels are split into as many groups as needed, and the filter state is
+// kept structure-of-arrays: one register per section per group, one lane per
+// channel. Coefficients are stored once and broadcast to all lanes.
+//
+// Without JUCE_USE_SIMD each channel is its own group and runs through the
+// scalar version of the same kernel in place. SampleType is float or double.
+//
+// Switching a stage on or off crossfades it against its own input over
+// fadeLengthSeconds, so a stage can drop out of the cascade when its settings
+// make it neutral without clicking. With no stages left and nothing fading,
+// process() leaves the block untouched.
+//
+// Once the filter state has decayed below noiseFloor, blocks whose input is
+// below it too are passed straight through until the input comes back.
+template <typename SampleType>
+class SIMDFilterChain
+{
+public:
+   #if JUCE_USE_SIMD
+    using Vector = juce::dsp::SIMDRegister<SampleType>;
+   #else
+    using Vector = SampleType;
+   #endif
+
+    static constexpr size_t numLanes = sizeof(Vector) / sizeof(SampleType);
+    static constexpr size_t maxChannels = 64;
+
+    // Input and state quieter than this (-160 dB) count as silence.
+    static constexpr double noiseFloor = 1.0e-8;
+
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    void setLowCutCoefficients(const CutCoefficients& coefficients);
+    void setPeakCoefficients(const CoefficientArray& coefficients);
+    void setHighCutCoefficients(const CutCoefficients& coefficients);
+
+    // A stage being switched off keeps running until it has faded out.
+    void setStageEnabled(CascadeStage stage, bool shouldBeEnabled);
+
+    void process(const juce::dsp::ProcessContextReplacing<SampleType>& context);
+
+    const FilterCascade<SampleType>& getCascade() const { return cascade; }
+
+private:
+    static constexpr double fadeLengthSeconds = 0.01;
+    static constexpr int numStages = FilterCascade<SampleType>::numStages;
+
+    using Stage = CascadeStage;
+    using Layout = typename FilterCascade<SampleType>::Layout;
+    using State = std::array<Vector, FilterCascade<SampleType>::maxSections>;
+
+    struct GroupState
+    {
+        State state1, state2;
+    };
+
+    static Vector broadcast(SampleType value);
+
+    void relayoutState(const Layout& previousLayout);
+
+    void clearState();
+    bool isBelowNoiseFloor(const juce::dsp::AudioBlock<SampleType>& block) const;
+    bool isStateBelowNoiseFloor() const;
+
+    // At most maximumBlockSize samples.
+    void processChunk(juce::dsp::AudioBlock<SampleType>& block);
+
+    bool advanceFades(size_t numSamples);
+    void removeFadedOutStages();
+    void processGroup(Vector* samples, size_t numSamples, GroupState& state);
+
+    void interleave(const juce::dsp::AudioBlock<SampleType>& block, size_t firstChannel, size_t numChannelsInGroup);
+    void deinterleave(juce::dsp::AudioBlock<SampleType>& block, size_t firstChannel, size_t numChannelsInGroup) const;
+
+    FilterCascade<SampleType> cascade;
+
+    size_t numChannels{ 0 };
+    size_t maximumBlockSize{ 0 };
+    std::vector<GroupState> groupStates;
+    bool stateIsSilent{ true };
+    std::vector<Vector> interleaved;
+
+    // 0 when a stage is out of the cascade, 1 when it is fully in.
+    std::array<juce::SmoothedValue<SampleType, juce::ValueSmoothingTypes::Linear>, numStages> fades;
+    std::array<bool, numStages> stageIsFading{};
+    std::array<std::vector<SampleType>, numStages> fadeGains;
+    std::vector<Vector> dry;
+};
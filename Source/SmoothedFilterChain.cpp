@@ -0,0 +1,302 @@
+/*
+  ==============================================================================
+
+    SmoothedFilterChain.cpp
+    Created: 18 Oct 2026 1:05:51pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "SmoothedFilterChain.h"
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    sampleRate = spec.sampleRate;
+
+    lowCutFreq.reset(sampleRate, rampLengthSeconds);
+    highCutFreq.reset(sampleRate, rampLengthSeconds);
+    peakFreq.reset(sampleRate, rampLengthSeconds);
+    peakQuality.reset(sampleRate, rampLengthSeconds);
+    peakGain.reset(sampleRate, rampLengthSeconds);
+
+    for (int gainIndex = 0; gainIndex < maxCutSections; gainIndex++)
+    {
+        auto order = (gainIndex + 1) * 2;
+
+        for (int section = 0; section <= gainIndex; section++)
+        {
+            auto angle = (2.0 * section + 1.0) * juce::MathConstants<double>::pi / (order * 2.0);
+            butterworthDamping[gainIndex][section] = 2.0 * std::cos(angle);
+        }
+    }
+
+    channelStates.resize(spec.numChannels);
+    reset();
+
+    lowCutNeedsDesign = peakNeedsDesign = highCutNeedsDesign = true;
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::reset()
+{
+    std::fill(channelStates.begin(), channelStates.end(), ChannelState());
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::setControlRateDivisor(int newDivisor)
+{
+    controlRateDivisor = juce::jmax(1, newDivisor);
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::setCurrentSettings(const PeakSettings& peak, const CutSettings& lowCut, const CutSettings& highCut)
+{
+    lowCutFreq.setCurrentAndTargetValue(lowCut.freq);
+    highCutFreq.setCurrentAndTargetValue(highCut.freq);
+    peakFreq.setCurrentAndTargetValue(peak.freq);
+    peakQuality.setCurrentAndTargetValue(peak.quality);
+    peakGain.setCurrentAndTargetValue(peak.gainInDecibels);
+
+    numLowCutSections = lowCut.gainIndex + 1;
+    numHighCutSections = highCut.gainIndex + 1;
+
+    lowCutNeedsDesign = peakNeedsDesign = highCutNeedsDesign = true;
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::setTargetSettings(const PeakSettings& peak, const CutSettings& lowCut, const CutSettings& highCut)
+{
+    lowCutFreq.setTargetValue(lowCut.freq);
+    highCutFreq.setTargetValue(highCut.freq);
+    peakFreq.setTargetValue(peak.freq);
+    peakQuality.setTargetValue(peak.quality);
+    peakGain.setTargetValue(peak.gainInDecibels);
+
+    if (numLowCutSections != lowCut.gainIndex + 1)
+    {
+        // Sections being switched in must not resume from stale state.
+        for (auto& state : channelStates)
+            std::fill(state.lowCut.begin() + juce::jmin(numLowCutSections, lowCut.gainIndex + 1), state.lowCut.end(), State());
+
+        numLowCutSections = lowCut.gainIndex + 1;
+        lowCutNeedsDesign = true;
+    }
+
+    if (numHighCutSections != highCut.gainIndex + 1)
+    {
+        for (auto& state : channelStates)
+            std::fill(state.highCut.begin() + juce::jmin(numHighCutSections, highCut.gainIndex + 1), state.highCut.end(), State());
+
+        numHighCutSections = highCut.gainIndex + 1;
+        highCutNeedsDesign = true;
+    }
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::process(const juce::dsp::ProcessContextReplacing<SampleType>& context)
+{
+    auto& block = context.getOutputBlock();
+
+    auto numChannels = juce::jmin(static_cast<int>(block.getNumChannels()), static_cast<int>(channelStates.size()));
+    auto numSamples = static_cast<int>(block.getNumSamples());
+
+    for (int start = 0; start < numSamples; start += controlRateDivisor)
+    {
+        auto subBlockSize = juce::jmin(controlRateDivisor, numSamples - start);
+
+        if (updateCoefficients(subBlockSize))
+        {
+            // The coefficients move every sample, so each one is worked out
+            // once and run across all the channels.
+            for (int i = 0; i < subBlockSize; i++)
+            {
+                advanceRamps();
+
+                for (int channel = 0; channel < numChannels; channel++)
+                {
+                    auto& sample = block.getChannelPointer(channel)[start + i];
+                    sample = processChannelSample(channelStates[channel], sample);
+                }
+            }
+
+            finishRamps();
+        }
+        else
+        {
+            for (int channel = 0; channel < numChannels; channel++)
+            {
+                auto* samples = block.getChannelPointer(channel) + start;
+                auto& state = channelStates[channel];
+
+                for (int i = 0; i < subBlockSize; i++)
+                    samples[i] = processChannelSample(state, samples[i]);
+            }
+        }
+    }
+}
+
+template <typename SampleType>
+double SmoothedFilterChain<SampleType>::getWarpedFrequency(float frequency) const
+{
+    auto nyquistSafe = juce::jmin(static_cast<double>(frequency), sampleRate * 0.49);
+    return std::tan(juce::MathConstants<double>::pi * nyquistSafe / sampleRate);
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::setRampTarget(Ramp& ramp, double g, double k, double m1, int numSamples)
+{
+    ramp.gTarget = static_cast<SampleType>(g);
+    ramp.kTarget = static_cast<SampleType>(k);
+    ramp.m1Target = static_cast<SampleType>(m1);
+
+    if (numSamples == 0)
+    {
+        ramp.g = ramp.gTarget;
+        ramp.k = ramp.kTarget;
+        ramp.m1 = ramp.m1Target;
+        ramp.gStep = ramp.kStep = ramp.m1Step = 0;
+        return;
+    }
+
+    auto scale = SampleType(1) / static_cast<SampleType>(numSamples);
+
+    ramp.gStep = (ramp.gTarget - ramp.g) * scale;
+    ramp.kStep = (ramp.kTarget - ramp.k) * scale;
+    ramp.m1Step = (ramp.m1Target - ramp.m1) * scale;
+}
+
+template <typename SampleType>
+typename SmoothedFilterChain<SampleType>::Coefficients SmoothedFilterChain<SampleType>::finishRamp(Ramp& ramp)
+{
+    // Lands exactly on the target rather than wherever the steps added up to.
+    ramp.g = ramp.gTarget;
+    ramp.k = ramp.kTarget;
+    ramp.m1 = ramp.m1Target;
+
+    return makeCoefficients(ramp.g, ramp.k, ramp.m0, ramp.m1, ramp.m2);
+}
+
+template <typename SampleType>
+bool SmoothedFilterChain<SampleType>::updateCoefficients(int numSamplesToSkip)
+{
+    // Only bands that are still ramping (or just had their slope switched)
+    // pay for a redesign; a settled chain just runs the SVF ticks. A band
+    // that needs designing from scratch has no ramp to start from, so it
+    // jumps to the end of the tick instead.
+    lowCutRamping = peakRamping = highCutRamping = false;
+
+    if (lowCutFreq.isSmoothing() || lowCutNeedsDesign)
+    {
+        lowCutRamping = !lowCutNeedsDesign;
+        designLowCut(lowCutFreq.skip(numSamplesToSkip), lowCutRamping ? numSamplesToSkip : 0);
+        lowCutNeedsDesign = false;
+    }
+
+    if (peakFreq.isSmoothing() || peakGain.isSmoothing() || peakQuality.isSmoothing() || peakNeedsDesign)
+    {
+        peakRamping = !peakNeedsDesign;
+        designPeak(peakFreq.skip(numSamplesToSkip),
+                   peakGain.skip(numSamplesToSkip),
+                   peakQuality.skip(numSamplesToSkip),
+                   peakRamping ? numSamplesToSkip : 0);
+        peakNeedsDesign = false;
+    }
+
+    if (highCutFreq.isSmoothing() || highCutNeedsDesign)
+    {
+        highCutRamping = !highCutNeedsDesign;
+        designHighCut(highCutFreq.skip(numSamplesToSkip), highCutRamping ? numSamplesToSkip : 0);
+        highCutNeedsDesign = false;
+    }
+
+    return lowCutRamping || peakRamping || highCutRamping;
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::advanceRamps()
+{
+    if (lowCutRamping)
+        for (int section = 0; section < numLowCutSections; section++)
+            lowCutCoefficients[section] = advanceRamp(lowCutRamps[section]);
+
+    if (peakRamping)
+        peakCoefficients = advanceRamp(peakRamp);
+
+    if (highCutRamping)
+        for (int section = 0; section < numHighCutSections; section++)
+            highCutCoefficients[section] = advanceRamp(highCutRamps[section]);
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::finishRamps()
+{
+    if (lowCutRamping)
+        for (int section = 0; section < numLowCutSections; section++)
+            lowCutCoefficients[section] = finishRamp(lowCutRamps[section]);
+
+    if (peakRamping)
+        peakCoefficients = finishRamp(peakRamp);
+
+    if (highCutRamping)
+        for (int section = 0; section < numHighCutSections; section++)
+            highCutCoefficients[section] = finishRamp(highCutRamps[section]);
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::designLowCut(float frequency, int numSamples)
+{
+    auto g = getWarpedFrequency(frequency);
+    auto& damping = butterworthDamping[numLowCutSections - 1];
+
+    for (int section = 0; section < numLowCutSections; section++)
+    {
+        auto& ramp = lowCutRamps[section];
+        auto k = damping[section];
+
+        ramp.m0 = SampleType(1);
+        ramp.m2 = SampleType(-1);
+        setRampTarget(ramp, g, k, -k, numSamples);
+
+        if (numSamples == 0)
+            lowCutCoefficients[section] = finishRamp(ramp);
+    }
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::designPeak(float frequency, float gainInDecibels, float quality, int numSamples)
+{
+    auto g = getWarpedFrequency(frequency);
+    auto a = std::pow(10.0, gainInDecibels / 40.0);
+    auto k = 1.0 / (quality * a);
+
+    peakRamp.m0 = SampleType(1);
+    peakRamp.m2 = SampleType(0);
+    setRampTarget(peakRamp, g, k, k * (a * a - 1.0), numSamples);
+
+    if (numSamples == 0)
+        peakCoefficients = finishRamp(peakRamp);
+}
+
+template <typename SampleType>
+void SmoothedFilterChain<SampleType>::designHighCut(float frequency, int numSamples)
+{
+    auto g = getWarpedFrequency(frequency);
+    auto& damping = butterworthDamping[numHighCutSections - 1];
+
+    for (int section = 0; section < numHighCutSections; section++)
+    {
+        auto& ramp = highCutRamps[section];
+
+        ramp.m0 = SampleType(0);
+        ramp.m2 = SampleType(1);
+        setRampTarget(ramp, g, damping[section], 0.0, numSamples);
+
+        if (numSamples == 0)
+            highCutCoefficients[section] = finishRamp(ramp);
+    }
+}
+
+template class SmoothedFilterChain<float>;
+template class SmoothedFilterChain<double>;
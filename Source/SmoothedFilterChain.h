@@ -0,0 +1,158 @@
+/*
+  ==============================================================================
+
+    SmoothedFilterChain.h
+    Created: 18 Oct 2026 1:05:51pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CoefficientDesign.h"
+
+// The low cut -> peak -> high cut chain built from topology-preserving
+// transform state variable filters. Unlike the direct form biquads in
+// MonoChain, the SVF stays well behaved when its coefficients change while
+// it is running, so parameters are smoothed instead of jumping once per
+// block. The smoothed parameters are only turned into g and k every
+// controlRateDivisor samples; in between, g and k move in a straight line,
+// so a ramping section costs a few multiplies and a divide per sample.
+// SampleType is float or double.
+template <typename SampleType>
+class SmoothedFilterChain
+{
+public:
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    // How often the warped frequencies and damping are worked out from the
+    // smoothed parameters. Larger values trade accuracy of the ramp's curve
+    // for CPU.
+    void setControlRateDivisor(int newDivisor);
+
+    // Jumps straight to the given settings without ramping, e.g. after prepare().
+    void setCurrentSettings(const PeakSettings& peak, const CutSettings& lowCut, const CutSettings& highCut);
+    void setTargetSettings(const PeakSettings& peak, const CutSettings& lowCut, const CutSettings& highCut);
+
+    void process(const juce::dsp::ProcessContextReplacing<SampleType>& context);
+
+private:
+    static constexpr int maxCutSections = 4;
+    static constexpr double rampLengthSeconds = 0.05;
+
+    struct Coefficients
+    {
+        SampleType a1{ 0 }, a2{ 0 }, a3{ 0 };
+        SampleType m0{ 1 }, m1{ 0 }, m2{ 0 };
+    };
+
+    // Where a section's g, k and m1 are on their way to the end of the
+    // current control tick. m0 and m2 never change for a given band type.
+    struct Ramp
+    {
+        SampleType g{ 0 }, k{ 0 }, m1{ 0 };
+        SampleType gStep{ 0 }, kStep{ 0 }, m1Step{ 0 };
+        SampleType gTarget{ 0 }, kTarget{ 0 }, m1Target{ 0 };
+        SampleType m0{ 1 }, m2{ 0 };
+    };
+
+    struct State
+    {
+        SampleType ic1eq{ 0 }, ic2eq{ 0 };
+    };
+
+    struct ChannelState
+    {
+        std::array<State, maxCutSections> lowCut;
+        State peak;
+        std::array<State, maxCutSections> highCut;
+    };
+
+    static Coefficients makeCoefficients(SampleType g, SampleType k, SampleType m0, SampleType m1, SampleType m2)
+    {
+        Coefficients coefficients;
+
+        coefficients.a1 = SampleType(1) / (SampleType(1) + g * (g + k));
+        coefficients.a2 = g * coefficients.a1;
+        coefficients.a3 = g * coefficients.a2;
+        coefficients.m0 = m0;
+        coefficients.m1 = m1;
+        coefficients.m2 = m2;
+
+        return coefficients;
+    }
+
+    static Coefficients advanceRamp(Ramp& ramp)
+    {
+        ramp.g += ramp.gStep;
+        ramp.k += ramp.kStep;
+        ramp.m1 += ramp.m1Step;
+
+        return makeCoefficients(ramp.g, ramp.k, ramp.m0, ramp.m1, ramp.m2);
+    }
+
+    static SampleType processSample(const Coefficients& coefficients, State& state, SampleType input)
+    {
+        auto v3 = input - state.ic2eq;
+        auto v1 = coefficients.a1 * state.ic1eq + coefficients.a2 * v3;
+        auto v2 = state.ic2eq + coefficients.a2 * state.ic1eq + coefficients.a3 * v3;
+
+        state.ic1eq = SampleType(2) * v1 - state.ic1eq;
+        state.ic2eq = SampleType(2) * v2 - state.ic2eq;
+
+        return coefficients.m0 * input + coefficients.m1 * v1 + coefficients.m2 * v2;
+    }
+
+    SampleType processChannelSample(ChannelState& state, SampleType sample) const
+    {
+        for (int section = 0; section < numLowCutSections; section++)
+            sample = processSample(lowCutCoefficients[section], state.lowCut[section], sample);
+
+        sample = processSample(peakCoefficients, state.peak, sample);
+
+        for (int section = 0; section < numHighCutSections; section++)
+            sample = processSample(highCutCoefficients[section], state.highCut[section], sample);
+
+        return sample;
+    }
+
+    double getWarpedFrequency(float frequency) const;
+
+    // Sets where the ramp ends numSamples from now. 0 jumps straight there.
+    static void setRampTarget(Ramp& ramp, double g, double k, double m1, int numSamples);
+    static Coefficients finishRamp(Ramp& ramp);
+
+    // Returns whether any band ramps over the next numSamplesToSkip samples.
+    bool updateCoefficients(int numSamplesToSkip);
+    void advanceRamps();
+    void finishRamps();
+
+    void designLowCut(float frequency, int numSamples);
+    void designPeak(float frequency, float gainInDecibels, float quality, int numSamples);
+    void designHighCut(float frequency, int numSamples);
+
+    double sampleRate{ 44100.0 };
+    int controlRateDivisor{ 16 };
+
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> lowCutFreq, highCutFreq, peakFreq, peakQuality;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> peakGain;
+
+    // The slope choices can't be ramped, they switch the section count directly.
+    int numLowCutSections{ 0 }, numHighCutSections{ 0 };
+    bool lowCutNeedsDesign{ true }, peakNeedsDesign{ true }, highCutNeedsDesign{ true };
+    bool lowCutRamping{ false }, peakRamping{ false }, highCutRamping{ false };
+
+    // Butterworth damping (1 / Q) of each section, indexed by slope choice.
+    std::array<std::array<double, maxCutSections>, maxCutSections> butterworthDamping{};
+
+    std::array<Coefficients, maxCutSections> lowCutCoefficients, highCutCoefficients;
+    Coefficients peakCoefficients;
+
+    std::array<Ramp, maxCutSections> lowCutRamps, highCutRamps;
+    Ramp peakRamp;
+
+    std::vector<ChannelState> channelStates;
+};
@@ -0,0 +1,221 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyzer.cpp
+    Created: 19 Oct 2026 1:02:46am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyzer.h"
+
+namespace
+{
+    // The response curve's axis: proportion 0 to 1 across the width is 20 Hz
+    // to 20 kHz, logarithmically.
+    double getFrequencyForProportion(double proportion)
+    {
+        return 20.0 * std::pow(1000.0, proportion);
+    }
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer(AnalyzerTap& tapToRead)
+    : juce::Thread("Spectrum analyzer"),
+    tap(tapToRead),
+    attached(tap.attachReader())
+{
+    fftData.resize(static_cast<size_t>(fftSize) * 2);
+    readBuffer.resize(static_cast<size_t>(fftSize));
+
+    for (auto& side : sides)
+        side.history.resize(static_cast<size_t>(fftSize));
+
+    if (attached)
+        startThread();
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    stopThread(1000);
+
+    if (attached)
+        tap.detachReader();
+}
+
+void SpectrumAnalyzer::setDisplaySize(int width, int height)
+{
+    const juce::ScopedLock sl(lock);
+
+    displayWidth = width;
+    displayHeight = height;
+}
+
+std::shared_ptr<const SpectrumAnalyzer::Paths> SpectrumAnalyzer::getPaths() const
+{
+    const juce::ScopedLock sl(lock);
+    return paths;
+}
+
+void SpectrumAnalyzer::run()
+{
+    auto lastFrameTime = juce::Time::getMillisecondCounterHiRes();
+
+    while (!threadShouldExit())
+    {
+        wait(frameIntervalMs);
+
+        auto frameTime = juce::Time::getMillisecondCounterHiRes();
+        auto elapsedSeconds = (frameTime - lastFrameTime) * 0.001;
+        lastFrameTime = frameTime;
+
+        int width, height;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            width = displayWidth;
+            height = displayHeight;
+        }
+
+        auto hasInput = drain(AnalyzerTap::Input, sides[AnalyzerTap::Input]);
+        auto hasOutput = drain(AnalyzerTap::Output, sides[AnalyzerTap::Output]);
+
+        // A host that stops processing leaves the last spectrum showing.
+        if (!(hasInput || hasOutput) || width <= 0 || height <= 0)
+            continue;
+
+        updateBinning(width, tap.getSampleRate());
+
+        for (auto& side : sides)
+            analyse(side, elapsedSeconds);
+
+        auto newPaths = std::make_shared<Paths>();
+        newPaths->input = createPath(sides[AnalyzerTap::Input], height);
+        newPaths->output = createPath(sides[AnalyzerTap::Output], height);
+
+        const juce::ScopedLock sl(lock);
+        paths = std::move(newPaths);
+    }
+}
+
+bool SpectrumAnalyzer::drain(AnalyzerTap::Side tapSide, Side& side)
+{
+    bool anyRead = false;
+
+    for (;;)
+    {
+        auto numRead = tap.read(tapSide, readBuffer.data(), static_cast<int>(readBuffer.size()));
+
+        if (numRead == 0)
+            return anyRead;
+
+        anyRead = true;
+
+        for (int i = 0; i < numRead; i++)
+        {
+            side.history[static_cast<size_t>(side.writePosition)] = readBuffer[static_cast<size_t>(i)];
+            side.writePosition = (side.writePosition + 1) % fftSize;
+        }
+    }
+}
+
+void SpectrumAnalyzer::analyse(Side& side, double elapsedSeconds)
+{
+    using namespace juce;
+
+    // Oldest first.
+    auto oldest = side.history.begin() + side.writePosition;
+    auto copied = std::copy(oldest, side.history.end(), fftData.begin());
+    std::copy(side.history.begin(), oldest, copied);
+    std::fill(fftData.begin() + fftSize, fftData.end(), 0.f);
+
+    window.multiplyWithWindowingTable(fftData.data(), static_cast<size_t>(fftSize));
+    fft.performFrequencyOnlyForwardTransform(fftData.data());
+
+    // The window is normalised to a mean of one, so this puts a full scale
+    // sine at 0 dB.
+    auto scale = 2.f / static_cast<float>(fftSize);
+
+    auto attack = static_cast<float>(std::exp(-elapsedSeconds / attackSeconds));
+    auto release = static_cast<float>(std::exp(-elapsedSeconds / releaseSeconds));
+
+    for (int x = 0; x < binnedWidth; x++)
+    {
+        auto firstBin = firstBins[static_cast<size_t>(x)];
+        auto endBin = endBins[static_cast<size_t>(x)];
+        float magnitude;
+
+        if (endBin > firstBin)
+        {
+            magnitude = *std::max_element(fftData.begin() + firstBin, fftData.begin() + endBin);
+        }
+        else
+        {
+            auto position = binPositions[static_cast<size_t>(x)];
+            auto bin = static_cast<int>(position);
+            auto fraction = position - static_cast<float>(bin);
+
+            magnitude = fftData[static_cast<size_t>(bin)] * (1.f - fraction) + fftData[static_cast<size_t>(bin) + 1] * fraction;
+        }
+
+        auto decibels = Decibels::gainToDecibels(magnitude * scale, minDecibels);
+        auto& value = side.display[static_cast<size_t>(x)];
+
+        value = decibels + (decibels > value ? attack : release) * (value - decibels);
+    }
+}
+
+juce::Path SpectrumAnalyzer::createPath(const Side& side, int height) const
+{
+    juce::Path path;
+    path.preallocateSpace(binnedWidth * 3);
+
+    for (int x = 0; x < binnedWidth; x++)
+    {
+        auto y = juce::jmap(side.display[static_cast<size_t>(x)], minDecibels, maxDecibels, static_cast<float>(height), 0.f);
+
+        if (x == 0)
+            path.startNewSubPath(0.f, y);
+        else
+            path.lineTo(static_cast<float>(x), y);
+    }
+
+    return path;
+}
+
+void SpectrumAnalyzer::updateBinning(int width, double sampleRate)
+{
+    if (width == binnedWidth && sampleRate == binnedSampleRate)
+        return;
+
+    auto size = static_cast<size_t>(width);
+    firstBins.resize(size);
+    endBins.resize(size);
+    binPositions.resize(size);
+
+    auto binWidth = sampleRate / fftSize;
+    auto lastBin = fftSize / 2;
+
+    for (int x = 0; x < width; x++)
+    {
+        // Pixel x covers half a pixel either side of its own frequency.
+        auto lowEdge = getFrequencyForProportion((x - 0.5) / width) / binWidth;
+        auto highEdge = getFrequencyForProportion((x + 0.5) / width) / binWidth;
+
+        auto firstBin = juce::jlimit(0, lastBin + 1, static_cast<int>(std::ceil(lowEdge)));
+        auto endBin = juce::jlimit(0, lastBin + 1, static_cast<int>(std::floor(highEdge)) + 1);
+
+        firstBins[static_cast<size_t>(x)] = firstBin;
+        endBins[static_cast<size_t>(x)] = endBin;
+
+        auto centre = getFrequencyForProportion(static_cast<double>(x) / width) / binWidth;
+        binPositions[static_cast<size_t>(x)] = static_cast<float>(juce::jlimit(0.0, lastBin - 0.001, centre));
+    }
+
+    for (auto& side : sides)
+        side.display.assign(size, minDecibels);
+
+    binnedWidth = width;
+    binnedSampleRate = sampleRate;
+}
@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyzer.h
+    Created: 19 Oct 2026 1:02:46am
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "AnalyzerTap.h"
+
+// Turns what an AnalyzerTap carries into input and output spectrum paths for
+// the response curve, all on a background thread.
+//
+// At the display rate it drains the tap, runs a Hann windowed FFT over the
+// latest fftSize samples of each side, and reduces the bins to one value per
+// pixel on the same log frequency axis as the response curve: the loudest bin
+// where a pixel spans several, interpolated where it falls between two. Each
+// pixel then follows its value with a fast attack and a slow release, and the
+// paths get a point per pixel, however many bins there are.
+//
+// Attaches to the tap for as long as it lives, which is what switches the
+// tap on.
+class SpectrumAnalyzer : private juce::Thread
+{
+public:
+    static constexpr int fftOrder = 12;
+    static constexpr int fftSize = 1 << fftOrder;
+
+    // The decibel range mapped onto the height of the display.
+    static constexpr float minDecibels = -90.f;
+    static constexpr float maxDecibels = 0.f;
+
+    struct Paths
+    {
+        juce::Path input;
+        juce::Path output;
+    };
+
+    explicit SpectrumAnalyzer(AnalyzerTap& tap);
+    ~SpectrumAnalyzer() override;
+
+    // Message thread. In the response curve's local coordinates.
+    void setDisplaySize(int width, int height);
+
+    // The most recent paths, never changed once published. Null until the
+    // first audio arrives, or if another analyzer already has the tap.
+    std::shared_ptr<const Paths> getPaths() const;
+
+private:
+    static constexpr int frameIntervalMs = 16;
+    static constexpr double attackSeconds = 0.01;
+    static constexpr double releaseSeconds = 0.4;
+
+    struct Side
+    {
+        // The latest fftSize samples, oldest at writePosition.
+        std::vector<float> history;
+        int writePosition{ 0 };
+
+        // Smoothed decibels, a value per pixel.
+        std::vector<float> display;
+    };
+
+    void run() override;
+
+    // Returns whether any new samples came in.
+    bool drain(AnalyzerTap::Side tapSide, Side& side);
+    void analyse(Side& side, double elapsedSeconds);
+    juce::Path createPath(const Side& side, int height) const;
+
+    // Works out which bins land on each pixel.
+    void updateBinning(int width, double sampleRate);
+
+    AnalyzerTap& tap;
+    const bool attached;
+
+    juce::CriticalSection lock;
+    int displayWidth{ 0 }, displayHeight{ 0 };
+    std::shared_ptr<const Paths> paths;
+
+    // Only touched by the worker.
+    juce::dsp::FFT fft{ fftOrder };
+    juce::dsp::WindowingFunction<float> window{ static_cast<size_t>(fftSize), juce::dsp::WindowingFunction<float>::hann };
+    std::vector<float> fftData, readBuffer;
+    std::array<Side, 2> sides;
+
+    // Per pixel: the range of bins [firstBin, endBin) it covers, or, where
+    // that's empty, the fractional bin to interpolate at.
+    std::vector<int> firstBins, endBins;
+    std::vector<float> binPositions;
+    int binnedWidth{ 0 };
+    double binnedSampleRate{ 0.0 };
+};
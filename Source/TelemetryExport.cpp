@@ -0,0 +1,421 @@
+/*
+  ==============================================================================
+
+    TelemetryExport.cpp
+    Created: 18 Oct 2026 10:26:54pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "TelemetryExport.h"
+
+#if JUCE_WINDOWS
+extern "C" __declspec(dllimport) unsigned long __stdcall GetCurrentProcessId();
+#else
+ #include <unistd.h>
+#endif
+
+namespace Telemetry
+{
+    namespace
+    {
+        // Bumped whenever Layout or Snapshot changes, along with the file name,
+        // so old and new builds never read each other's records.
+        constexpr juce::uint32 layoutMagic = 0x53455133;   // "SEQ3"
+        constexpr const char* fileName = "SimpleEQ-telemetry-3";
+
+        constexpr int publishIntervalMs = 100;
+
+        // A record whose owner hasn't refreshed it for this long is taken to
+        // belong to a process that died, and can be claimed again.
+        constexpr juce::int64 staleAfterMs = 5000;
+
+        constexpr int numWords = static_cast<int>((sizeof(Snapshot) + sizeof(juce::uint64) - 1) / sizeof(juce::uint64));
+
+        // The file is shared between processes, which only works for atomics
+        // that don't fall back on a lock.
+        static_assert(std::atomic<juce::uint64>::is_always_lock_free);
+        static_assert(std::atomic<juce::int64>::is_always_lock_free);
+        static_assert(std::atomic<juce::uint32>::is_always_lock_free);
+
+        struct Record
+        {
+            // Zero while the record is free, otherwise when its owner last
+            // refreshed it, in milliseconds since the epoch.
+            std::atomic<juce::int64> heartbeatMs;
+
+            // Odd while the payload is being written.
+            std::atomic<juce::uint32> sequence;
+
+            std::array<std::atomic<juce::uint64>, numWords> payload;
+        };
+
+        // The whole file. A new file is all zeros, which is a valid empty
+        // state for every field.
+        struct Layout
+        {
+            std::atomic<juce::uint32> magic;
+            std::atomic<juce::uint32> numParameters;
+
+            // Instances that found no free record.
+            std::atomic<juce::uint32> numOverflowed;
+
+            std::array<std::array<char, maxNameLength>, maxParameters> parameterNames;
+            std::array<Record, maxInstances> records;
+        };
+
+        juce::int64 now()
+        {
+            return juce::Time::currentTimeMillis();
+        }
+
+        juce::uint32 getProcessId()
+        {
+           #if JUCE_WINDOWS
+            return static_cast<juce::uint32>(GetCurrentProcessId());
+           #else
+            return static_cast<juce::uint32>(getpid());
+           #endif
+        }
+
+        void writeRecord(Record& record, const Snapshot& snapshot)
+        {
+            std::array<juce::uint64, numWords> words{};
+            std::memcpy(words.data(), &snapshot, sizeof(snapshot));
+
+            auto sequence = record.sequence.load(std::memory_order_relaxed);
+            record.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (int i = 0; i < numWords; i++)
+                record.payload[static_cast<size_t>(i)].store(words[static_cast<size_t>(i)], std::memory_order_relaxed);
+
+            record.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        bool readRecord(const Record& record, Snapshot& snapshot)
+        {
+            // A write takes well under a microsecond, so a handful of retries
+            // only runs out if the writer died halfway through one.
+            for (int attempt = 0; attempt < 100; attempt++)
+            {
+                auto sequenceBefore = record.sequence.load(std::memory_order_acquire);
+
+                if ((sequenceBefore & 1) != 0)
+                {
+                    juce::Thread::yield();
+                    continue;
+                }
+
+                std::array<juce::uint64, numWords> words;
+
+                for (int i = 0; i < numWords; i++)
+                    words[static_cast<size_t>(i)] = record.payload[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (record.sequence.load(std::memory_order_relaxed) == sequenceBefore)
+                {
+                    std::memcpy(&snapshot, words.data(), sizeof(snapshot));
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Grows the file to the full layout without touching anything another
+        // process may already have written to it.
+        bool prepareFile(const juce::File& file)
+        {
+            if (file.getSize() >= static_cast<juce::int64>(sizeof(Layout)))
+                return true;
+
+            juce::FileOutputStream stream(file);
+
+            if (stream.failedToOpen() || !stream.setPosition(static_cast<juce::int64>(sizeof(Layout)) - 1))
+                return false;
+
+            return stream.writeByte(0);
+        }
+    }
+
+    juce::File getDefaultFile()
+    {
+        juce::File sharedMemory("/dev/shm");
+
+        if (sharedMemory.isDirectory())
+            return sharedMemory.getChildFile(fileName);
+
+        return juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile(fileName);
+    }
+
+    bool isEnabled()
+    {
+       #if SIMPLEEQ_TELEMETRY_EXPORT
+        static const bool enabled = juce::SystemStats::getEnvironmentVariable("SIMPLEEQ_TELEMETRY", {}) == "1";
+        return enabled;
+       #else
+        return false;
+       #endif
+    }
+
+   #if SIMPLEEQ_TELEMETRY_EXPORT
+
+    // One per process, shared by every registered instance.
+    class Publisher : private juce::Thread
+    {
+    public:
+        Publisher() : juce::Thread("Telemetry export")
+        {
+            auto file = getDefaultFile();
+
+            if (prepareFile(file))
+                mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readWrite, false);
+
+            if (mappedFile != nullptr && mappedFile->getData() != nullptr && mappedFile->getSize() >= sizeof(Layout))
+            {
+                auto* mapped = static_cast<Layout*>(mappedFile->getData());
+                auto magic = mapped->magic.load(std::memory_order_acquire);
+
+                // Zero for a new file. Anything else has a layout we can't read.
+                if (magic == 0 || magic == layoutMagic)
+                    layout = mapped;
+            }
+
+            startThread();
+        }
+
+        ~Publisher() override
+        {
+            stopThread(1000);
+        }
+
+        static std::shared_ptr<Publisher> getInstance()
+        {
+            static juce::CriticalSection lock;
+            static std::weak_ptr<Publisher> instance;
+
+            const juce::ScopedLock sl(lock);
+
+            auto publisher = instance.lock();
+
+            if (publisher == nullptr)
+            {
+                publisher = std::make_shared<Publisher>();
+                instance = publisher;
+            }
+
+            return publisher;
+        }
+
+        void add(Registration& registration, const juce::StringArray& parameterNames)
+        {
+            if (layout == nullptr)
+                return;
+
+            writeParameterNames(parameterNames);
+
+            auto index = claimRecord();
+
+            if (index < 0)
+            {
+                layout->numOverflowed.fetch_add(1, std::memory_order_relaxed);
+                juce::Logger::writeToLog("SimpleEQ telemetry: all " + juce::String(maxInstances)
+                                         + " records are taken, so this instance won't be published");
+                return;
+            }
+
+            const juce::ScopedLock sl(lock);
+
+            registration.recordIndex = index;
+            registrations.push_back(&registration);
+        }
+
+        void remove(Registration& registration)
+        {
+            const juce::ScopedLock sl(lock);
+
+            auto found = std::find(registrations.begin(), registrations.end(), &registration);
+
+            if (found == registrations.end())
+                return;
+
+            registrations.erase(found);
+            layout->records[static_cast<size_t>(registration.recordIndex)].heartbeatMs.store(0, std::memory_order_release);
+        }
+
+    private:
+        void run() override
+        {
+            while (!threadShouldExit())
+            {
+                {
+                    const juce::ScopedLock sl(lock);
+
+                    for (auto* registration : registrations)
+                    {
+                        Snapshot snapshot;
+                        registration->fillFunction(snapshot);
+
+                        snapshot.processId = processId;
+                        snapshot.instanceId = registration->instanceId;
+
+                        auto& record = layout->records[static_cast<size_t>(registration->recordIndex)];
+                        writeRecord(record, snapshot);
+                        record.heartbeatMs.store(now(), std::memory_order_release);
+                    }
+                }
+
+                wait(publishIntervalMs);
+            }
+        }
+
+        // Every instance has the same parameters, so whoever gets here first
+        // names them, and the magic is only set once they're in place.
+        void writeParameterNames(const juce::StringArray& parameterNames)
+        {
+            if (layout->magic.load(std::memory_order_acquire) == layoutMagic)
+                return;
+
+            auto numParameters = juce::jmin(parameterNames.size(), maxParameters);
+
+            for (int i = 0; i < numParameters; i++)
+                parameterNames[i].copyToUTF8(layout->parameterNames[static_cast<size_t>(i)].data(), maxNameLength);
+
+            layout->numParameters.store(static_cast<juce::uint32>(numParameters), std::memory_order_relaxed);
+            layout->magic.store(layoutMagic, std::memory_order_release);
+        }
+
+        int claimRecord()
+        {
+            auto claimTime = now();
+
+            for (int i = 0; i < maxInstances; i++)
+            {
+                auto& record = layout->records[static_cast<size_t>(i)];
+                auto heartbeat = record.heartbeatMs.load(std::memory_order_acquire);
+
+                if (heartbeat != 0 && claimTime - heartbeat < staleAfterMs)
+                    continue;
+
+                if (record.heartbeatMs.compare_exchange_strong(heartbeat, claimTime, std::memory_order_acq_rel))
+                {
+                    // A writer that died halfway through leaves the sequence odd.
+                    auto sequence = record.sequence.load(std::memory_order_relaxed);
+                    record.sequence.store((sequence + 1) & ~1u, std::memory_order_relaxed);
+
+                    return i;
+                }
+            }
+
+            return -1;
+        }
+
+        std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+        Layout* layout{ nullptr };
+        const juce::uint32 processId{ getProcessId() };
+
+        juce::CriticalSection lock;
+        std::vector<Registration*> registrations;
+    };
+
+    Registration::Registration(const juce::StringArray& parameterNames, FillFunction fill)
+        : publisher(isEnabled() ? Publisher::getInstance() : nullptr),
+        fillFunction(std::move(fill)),
+        instanceId(static_cast<juce::uint32>(juce::Random::getSystemRandom().nextInt()))
+    {
+        if (publisher != nullptr)
+            publisher->add(*this, parameterNames);
+    }
+
+    Registration::~Registration()
+    {
+        if (publisher != nullptr)
+            publisher->remove(*this);
+    }
+
+   #else
+
+    Registration::Registration(const juce::StringArray&, FillFunction)
+    {
+    }
+
+    Registration::~Registration()
+    {
+    }
+
+   #endif
+
+    Reader::Reader(const juce::File& file)
+    {
+        if (file.getSize() >= static_cast<juce::int64>(sizeof(Layout)))
+            mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly, false);
+    }
+
+    Reader::~Reader()
+    {
+    }
+
+    bool Reader::isOpen() const
+    {
+        if (mappedFile == nullptr || mappedFile->getData() == nullptr || mappedFile->getSize() < sizeof(Layout))
+            return false;
+
+        return static_cast<const Layout*>(mappedFile->getData())->magic.load(std::memory_order_acquire) == layoutMagic;
+    }
+
+    juce::uint32 Reader::getNumOverflowed() const
+    {
+        if (!isOpen())
+            return 0;
+
+        return static_cast<const Layout*>(mappedFile->getData())->numOverflowed.load(std::memory_order_relaxed);
+    }
+
+    juce::StringArray Reader::getParameterNames() const
+    {
+        juce::StringArray names;
+
+        if (!isOpen())
+            return names;
+
+        auto* layout = static_cast<const Layout*>(mappedFile->getData());
+        auto numParameters = juce::jmin(static_cast<int>(layout->numParameters.load(std::memory_order_relaxed)), maxParameters);
+
+        for (int i = 0; i < numParameters; i++)
+        {
+            auto& name = layout->parameterNames[static_cast<size_t>(i)];
+            names.add(juce::String::fromUTF8(name.data(), static_cast<int>(strnlen(name.data(), name.size()))));
+        }
+
+        return names;
+    }
+
+    std::vector<Snapshot> Reader::read(juce::int64 maxAgeMs) const
+    {
+        std::vector<Snapshot> snapshots;
+
+        if (!isOpen())
+            return snapshots;
+
+        auto* layout = static_cast<const Layout*>(mappedFile->getData());
+        auto readTime = now();
+
+        for (auto& record : layout->records)
+        {
+            auto heartbeat = record.heartbeatMs.load(std::memory_order_acquire);
+
+            if (heartbeat == 0 || readTime - heartbeat > maxAgeMs)
+                continue;
+
+            Snapshot snapshot;
+
+            if (readRecord(record, snapshot))
+                snapshots.push_back(snapshot);
+        }
+
+        return snapshots;
+    }
+}
@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    TelemetryExport.h
+    Created: 18 Oct 2026 10:26:54pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef SIMPLEEQ_TELEMETRY_EXPORT
+ #define SIMPLEEQ_TELEMETRY_EXPORT 1
+#endif
+
+// Per instance metrics published to a memory mapped file that any local
+// process can poll, such as Tools/TelemetryMonitor.
+//
+// Every instance in every process claims a record in the one file, and a
+// background thread in each process refreshes the records of its instances
+// ten times a second. Each record is a seqlock: the publisher never waits,
+// and a reader just retries a record it caught halfway through a write. The
+// audio thread plays no part; the figures come from DspLoadMeter and the
+// parameter atomics.
+//
+// Publishing is opt in: nothing is created unless the SIMPLEEQ_TELEMETRY
+// environment variable is set to 1 when the first instance starts. Set
+// SIMPLEEQ_TELEMETRY_EXPORT to 0 to leave the file and thread out of the
+// build altogether, as the offline tools do.
+namespace Telemetry
+{
+    // Sessions run to hundreds of instances. Every record is under 200 bytes,
+    // so the whole file stays around 200 KB.
+    constexpr int maxInstances = 1024;
+    constexpr int maxParameters = 16;
+    constexpr int maxNameLength = 32;
+
+    // One instance's metrics. Plain data, copied into and out of a record whole.
+    struct Snapshot
+    {
+        juce::uint32 processId{ 0 };
+        juce::uint32 instanceId{ 0 };
+        double sampleRate{ 0.0 };
+        juce::int32 blockSize{ 0 };
+        float averageLoad{ 0.f };
+        float peakLoad{ 0.f };
+
+        // Estimated from the average load, for blocks of the full size.
+        float averageBlockMicroseconds{ 0.f };
+
+        juce::uint64 numBlocks{ 0 };
+        juce::uint64 numNearBudget{ 0 };
+        juce::uint64 numOverBudget{ 0 };
+        juce::uint64 numRecomputes{ 0 };
+
+        // CoefficientCache lookups, shared by every instance in the process.
+        juce::uint64 numCacheHits{ 0 };
+        juce::uint64 numCacheMisses{ 0 };
+
+        // In each parameter's own units, in the processor's parameter order.
+        juce::int32 numParameters{ 0 };
+        std::array<float, maxParameters> parameters{};
+    };
+
+    // Where instances publish to unless told otherwise: /dev/shm where it
+    // exists, otherwise the temp folder.
+    juce::File getDefaultFile();
+
+    // Whether instances in this process publish, read once per process.
+    bool isEnabled();
+
+    class Publisher;
+
+    // Keeps an instance's record claimed and refreshed for as long as it lives.
+    // fill is called on the publishing thread, never the audio thread.
+    class Registration
+    {
+    public:
+        using FillFunction = std::function<void(Snapshot&)>;
+
+        Registration(const juce::StringArray& parameterNames, FillFunction fill);
+        ~Registration();
+
+    private:
+       #if SIMPLEEQ_TELEMETRY_EXPORT
+        friend class Publisher;
+
+        std::shared_ptr<Publisher> publisher;
+        FillFunction fillFunction;
+        const juce::uint32 instanceId;
+        int recordIndex{ -1 };
+       #endif
+
+        JUCE_DECLARE_NON_COPYABLE(Registration)
+    };
+
+    // Reads the records of every instance publishing to a file.
+    class Reader
+    {
+    public:
+        explicit Reader(const juce::File& file = getDefaultFile());
+        ~Reader();
+
+        // False if the file doesn't exist yet or was written by another version.
+        bool isOpen() const;
+
+        // How many instances have found every record taken, and so publish
+        // nothing, since the file was created.
+        juce::uint32 getNumOverflowed() const;
+
+        juce::StringArray getParameterNames() const;
+
+        // A consistent copy of every record refreshed within the last maxAgeMs.
+        std::vector<Snapshot> read(juce::int64 maxAgeMs = 2000) const;
+
+    private:
+        std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+
+        JUCE_DECLARE_NON_COPYABLE(Reader)
+    };
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    TripleBuffer.h
+    Created: 18 Oct 2026 11:38:42pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Hands the latest value from a writer thread to a reader thread without
+// either of them ever waiting or allocating. There are three copies: the
+// writer fills its own and swaps it with the shared middle one, and the reader
+// swaps its own with the middle one only when something new was written. So
+// the reader always sees a whole value, and values it was too slow for are
+// skipped rather than queued.
+//
+// Only one thread may write at a time, and one may read at a time.
+template <typename T>
+class TripleBuffer
+{
+public:
+    // Writer only.
+    void write(const T& value)
+    {
+        buffers[writeIndex] = value;
+
+        auto previous = middle.exchange(static_cast<juce::uint8>(writeIndex | newDataFlag), std::memory_order_acq_rel);
+        writeIndex = previous & indexMask;
+    }
+
+    // Reader only. Picks up the latest value if there's a new one, returning
+    // whether there was.
+    bool update()
+    {
+        if ((middle.load(std::memory_order_relaxed) & newDataFlag) == 0)
+            return false;
+
+        auto previous = middle.exchange(static_cast<juce::uint8>(readIndex), std::memory_order_acq_rel);
+        readIndex = previous & indexMask;
+
+        return true;
+    }
+
+    // Reader only. The value picked up by the last update.
+    const T& get() const
+    {
+        return buffers[readIndex];
+    }
+
+private:
+    static constexpr juce::uint8 indexMask = 3;
+    static constexpr juce::uint8 newDataFlag = 4;
+
+    std::array<T, 3> buffers{};
+
+    juce::uint8 writeIndex{ 0 };
+    std::atomic<juce::uint8> middle{ 1 };
+    juce::uint8 readIndex{ 2 };
+};
@@ -0,0 +1,399 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Renders audio files through SimpleEQAudioProcessor without a host or an
+    editor, one processor instance per worker thread:
+
+        BatchRender --output <folder> [options] <files or folders...>
+
+        --state <file>            a state blob saved by getStateInformation
+        --param "<name>=<value>"  sets one parameter in its own units, e.g.
+                                  "Peak Gain=6"; may be repeated and is
+                                  applied after --state
+        --threads <n>             worker count, defaults to the core count
+        --block-size <n>          samples per processBlock, defaults to 512,
+                                  or 16384 with --stream
+        --stream                  reads, processes and writes each file in
+                                  overlapping stages with constant memory,
+                                  for recordings too long to render block
+                                  by block; see StreamingRender.h
+
+    Each file is written to the output folder under its own name and format,
+    with the plugin's latency compensated so the output lines up with the
+    input.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/PluginProcessor.h"
+#include "StreamingRender.h"
+
+namespace
+{
+    struct Settings
+    {
+        juce::File outputFolder;
+        juce::MemoryBlock state;
+        std::vector<std::pair<juce::String, float>> parameters;
+        int numThreads{ juce::SystemStats::getNumCpus() };
+        int blockSize{ 0 };
+        bool streaming{ false };
+        juce::Array<juce::File> inputs;
+    };
+
+    struct RenderResult
+    {
+        double audioSeconds{ 0.0 };
+        double renderSeconds{ 0.0 };
+        DspLoadMeter::Reading load;
+        juce::String error;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: BatchRender --output <folder> [--state <file>] [--param \"<name>=<value>\"]..." << std::endl
+                  << "                   [--threads <n>] [--block-size <n>] [--stream] <files or folders...>" << std::endl;
+    }
+
+    juce::String applySettings(SimpleEQAudioProcessor& processor, const Settings& settings)
+    {
+        if (settings.state.getSize() > 0)
+            processor.setStateInformation(settings.state.getData(), static_cast<int>(settings.state.getSize()));
+
+        for (auto& [name, value] : settings.parameters)
+        {
+            auto* parameter = processor.apvts.getParameter(name);
+
+            if (parameter == nullptr)
+                return "Unknown parameter: " + name;
+
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+        }
+
+        return {};
+    }
+
+    // One block at a time on the calling thread.
+    bool renderBlocks(juce::AudioProcessor& processor,
+                      juce::AudioFormatReader& reader,
+                      juce::AudioFormatWriter& writer,
+                      int blockSize)
+    {
+        auto numChannels = static_cast<int>(reader.numChannels);
+        auto totalLength = reader.lengthInSamples;
+        auto latency = static_cast<juce::int64>(processor.getLatencySamples());
+        auto samplesToSkip = latency;
+
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+        juce::MidiBuffer midi;
+
+        juce::int64 readPosition = 0, numWritten = 0;
+
+        // Reading past the end of the file gives silence, which flushes the
+        // latency out of the processor.
+        while (numWritten < totalLength)
+        {
+            auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(blockSize),
+                                                          totalLength + latency - readPosition));
+            juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+
+            reader.read(&block, 0, numSamples, readPosition, true, true);
+            processor.processBlock(block, midi);
+            readPosition += numSamples;
+
+            auto numToSkip = static_cast<int>(juce::jmin(samplesToSkip, static_cast<juce::int64>(numSamples)));
+            samplesToSkip -= numToSkip;
+
+            auto numToWrite = static_cast<int>(juce::jmin(static_cast<juce::int64>(numSamples - numToSkip), totalLength - numWritten));
+
+            if (numToWrite > 0 && !writer.writeFromAudioSampleBuffer(block, numToSkip, numToWrite))
+                return false;
+
+            numWritten += numToWrite;
+        }
+
+        return true;
+    }
+
+    RenderResult renderFile(SimpleEQAudioProcessor& processor,
+                            juce::AudioFormatManager& formatManager,
+                            const juce::File& input,
+                            const Settings& settings)
+    {
+        RenderResult result;
+        auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+        auto* format = formatManager.findFormatForFileExtension(input.getFileExtension());
+        std::unique_ptr<juce::AudioFormatReader> reader;
+
+        // Formats that can't be memory mapped, like FLAC, stream through a normal reader.
+        if (settings.streaming && format != nullptr)
+            reader.reset(format->createMemoryMappedReader(input));
+
+        if (reader == nullptr)
+            reader.reset(formatManager.createReaderFor(input));
+
+        if (reader == nullptr)
+        {
+            result.error = "Can't read " + input.getFullPathName();
+            return result;
+        }
+
+        auto numChannels = static_cast<int>(reader->numChannels);
+        auto sampleRate = reader->sampleRate;
+        auto blockSize = settings.blockSize;
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(juce::AudioChannelSet::canonicalChannelSet(numChannels));
+        layout.outputBuses.add(juce::AudioChannelSet::canonicalChannelSet(numChannels));
+
+        if (!processor.setBusesLayout(layout))
+        {
+            result.error = "Unsupported channel count (" + juce::String(numChannels) + ") in " + input.getFullPathName();
+            return result;
+        }
+
+        auto outputFile = settings.outputFolder.getChildFile(input.getFileName());
+        outputFile.deleteFile();
+
+        auto stream = outputFile.createOutputStream();
+        std::unique_ptr<juce::AudioFormatWriter> writer;
+
+        if (format != nullptr && stream != nullptr)
+            writer.reset(format->createWriterFor(stream.get(), sampleRate, reader->numChannels,
+                                                 static_cast<int>(reader->bitsPerSample), reader->metadataValues, 0));
+
+        if (writer == nullptr)
+        {
+            result.error = "Can't write " + outputFile.getFullPathName();
+            return result;
+        }
+
+        // The writer owns the stream now.
+        stream.release();
+
+        processor.setNonRealtime(true);
+        processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        if (settings.streaming)
+        {
+            auto error = renderStreaming(processor, *reader, std::move(writer), blockSize);
+
+            if (error.isNotEmpty())
+                result.error = error + " for " + input.getFullPathName();
+        }
+        else if (!renderBlocks(processor, *reader, *writer, blockSize))
+        {
+            result.error = "Write failed for " + outputFile.getFullPathName();
+        }
+
+        result.load = processor.getDspLoadMeter().getReading();
+        processor.releaseResources();
+
+        result.audioSeconds = static_cast<double>(reader->lengthInSamples) / sampleRate;
+        result.renderSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+
+        return result;
+    }
+
+    // Pulls files off the shared list until there are none left. Each
+    // worker owns its own processor, so nothing is shared while rendering.
+    class RenderWorker : public juce::ThreadPoolJob
+    {
+    public:
+        RenderWorker(const Settings& s, std::atomic<int>& index, juce::CriticalSection& lock)
+            : juce::ThreadPoolJob("Render worker"),
+            settings(s), nextIndex(index), outputLock(lock)
+        {
+            formatManager.registerBasicFormats();
+        }
+
+        // Created on the message thread along with the worker.
+        juce::String prepare()
+        {
+            processor = std::make_unique<SimpleEQAudioProcessor>();
+            return applySettings(*processor, settings);
+        }
+
+        JobStatus runJob() override
+        {
+            for (auto index = nextIndex++; index < settings.inputs.size(); index = nextIndex++)
+            {
+                auto& input = settings.inputs.getReference(index);
+                auto result = renderFile(*processor, formatManager, input, settings);
+
+                const juce::ScopedLock sl(outputLock);
+
+                if (result.error.isNotEmpty())
+                {
+                    std::cerr << result.error << std::endl;
+                    numFailed++;
+                    continue;
+                }
+
+                std::cout << input.getFileName() << ": "
+                          << juce::String(result.audioSeconds / result.renderSeconds, 1) << "x realtime";
+
+                // Only the last blocks of the file, but enough to catch a plugin
+                // that's slow in steady state.
+                if (result.load.numBlocks > 0)
+                    std::cout << ", DSP load " << juce::String(result.load.averageLoad * 100.f, 1) << "% (peak "
+                              << juce::String(result.load.peakLoad * 100.f, 1) << "%)";
+
+                std::cout << std::endl;
+
+                audioSeconds += result.audioSeconds;
+            }
+
+            return jobHasFinished;
+        }
+
+        double audioSeconds{ 0.0 };
+        int numFailed{ 0 };
+
+    private:
+        const Settings& settings;
+        std::atomic<int>& nextIndex;
+        juce::CriticalSection& outputLock;
+
+        juce::AudioFormatManager formatManager;
+        std::unique_ptr<SimpleEQAudioProcessor> processor;
+    };
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    Settings settings;
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    for (int i = 1; i < argc; i++)
+    {
+        juce::String arg(argv[i]);
+        auto nextArg = [&] { return i + 1 < argc ? juce::String(argv[++i]) : juce::String(); };
+
+        if (arg == "--output")
+        {
+            settings.outputFolder = juce::File::getCurrentWorkingDirectory().getChildFile(nextArg());
+        }
+        else if (arg == "--state")
+        {
+            auto stateFile = juce::File::getCurrentWorkingDirectory().getChildFile(nextArg());
+
+            if (!stateFile.loadFileAsData(settings.state))
+            {
+                std::cerr << "Can't read " << stateFile.getFullPathName() << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--param")
+        {
+            auto param = nextArg();
+
+            if (!param.containsChar('='))
+            {
+                std::cerr << "Expected \"<name>=<value>\", got " << param << std::endl;
+                return 1;
+            }
+
+            settings.parameters.emplace_back(param.upToFirstOccurrenceOf("=", false, false).trim(),
+                                             param.fromFirstOccurrenceOf("=", false, false).getFloatValue());
+        }
+        else if (arg == "--threads")
+        {
+            settings.numThreads = juce::jmax(1, nextArg().getIntValue());
+        }
+        else if (arg == "--block-size")
+        {
+            settings.blockSize = juce::jmax(1, nextArg().getIntValue());
+        }
+        else if (arg == "--stream")
+        {
+            settings.streaming = true;
+        }
+        else if (arg.startsWith("--"))
+        {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage();
+            return 1;
+        }
+        else
+        {
+            auto input = juce::File::getCurrentWorkingDirectory().getChildFile(arg);
+
+            if (input.isDirectory())
+                settings.inputs.addArray(input.findChildFiles(juce::File::findFiles, true, formatManager.getWildcardForAllFormats()));
+            else
+                settings.inputs.add(input);
+        }
+    }
+
+    if (settings.blockSize == 0)
+        settings.blockSize = settings.streaming ? 16384 : 512;
+
+    if (settings.outputFolder == juce::File() || settings.inputs.isEmpty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    if (!settings.outputFolder.createDirectory())
+    {
+        std::cerr << "Can't create " << settings.outputFolder.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    auto numWorkers = juce::jmin(settings.numThreads, settings.inputs.size());
+
+    std::atomic<int> nextIndex{ 0 };
+    juce::CriticalSection outputLock;
+    std::vector<std::unique_ptr<RenderWorker>> workers;
+
+    for (int i = 0; i < numWorkers; i++)
+    {
+        auto worker = std::make_unique<RenderWorker>(settings, nextIndex, outputLock);
+        auto error = worker->prepare();
+
+        if (error.isNotEmpty())
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+
+        workers.push_back(std::move(worker));
+    }
+
+    auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+    juce::ThreadPool pool(numWorkers);
+
+    for (auto& worker : workers)
+        pool.addJob(worker.get(), false);
+
+    for (auto& worker : workers)
+        pool.waitForJobToFinish(worker.get(), -1);
+
+    auto renderSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+
+    double audioSeconds = 0.0;
+    int numFailed = 0;
+
+    for (auto& worker : workers)
+    {
+        audioSeconds += worker->audioSeconds;
+        numFailed += worker->numFailed;
+    }
+
+    std::cout << "Rendered " << settings.inputs.size() - numFailed << " of " << settings.inputs.size() << " files, "
+              << juce::String(audioSeconds, 1) << " s of audio in " << juce::String(renderSeconds, 1) << " s on "
+              << numWorkers << " threads: " << juce::String(audioSeconds / renderSeconds, 1) << "x realtime" << std::endl;
+
+    return numFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+/*
+  ==============================================================================
+
+    StreamingRender.cpp
+    Created: 18 Oct 2026 7:48:20pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#include "StreamingRender.h"
+
+namespace
+{
+    // Chunks in flight between the reader, the DSP and the writer.
+    constexpr int numChunks = 4;
+    constexpr int pollIntervalMs = 100;
+
+    // Single producer, single consumer queue of chunk indices.
+    class ChunkQueue
+    {
+    public:
+        void push(int chunk)
+        {
+            {
+                const auto scope = fifo.write(1);
+                jassert(scope.blockSize1 == 1);
+
+                chunks[static_cast<size_t>(scope.startIndex1)] = chunk;
+            }
+
+            ready.signal();
+        }
+
+        // Gives up after timeoutMs so the caller can check on the other stages.
+        bool pop(int& chunk, int timeoutMs)
+        {
+            for (;;)
+            {
+                {
+                    const auto scope = fifo.read(1);
+
+                    if (scope.blockSize1 > 0)
+                    {
+                        chunk = chunks[static_cast<size_t>(scope.startIndex1)];
+                        return true;
+                    }
+                }
+
+                if (!ready.wait(timeoutMs))
+                    return false;
+            }
+        }
+
+    private:
+        // Every chunk fits at once, so push never has to wait.
+        juce::AbstractFifo fifo{ numChunks + 1 };
+        std::array<int, numChunks + 1> chunks{};
+        juce::WaitableEvent ready;
+    };
+
+    class ReaderThread : public juce::Thread
+    {
+    public:
+        ReaderThread(juce::AudioFormatReader& r,
+                     std::vector<juce::AudioBuffer<float>>& b,
+                     ChunkQueue& freeQueue,
+                     ChunkQueue& filledQueue,
+                     juce::int64 numSamplesToRead)
+            : juce::Thread("Streaming reader"),
+            reader(r), buffers(b), freeChunks(freeQueue), filledChunks(filledQueue), totalSamples(numSamplesToRead)
+        {
+        }
+
+        void run() override
+        {
+            auto* mappedReader = dynamic_cast<juce::MemoryMappedAudioFormatReader*>(&reader);
+
+            for (juce::int64 start = 0; start < totalSamples;)
+            {
+                int chunk;
+
+                if (!freeChunks.pop(chunk, pollIntervalMs))
+                {
+                    if (threadShouldExit())
+                        return;
+
+                    continue;
+                }
+
+                auto& buffer = buffers[static_cast<size_t>(chunk)];
+                auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(buffer.getNumSamples()), totalSamples - start));
+
+                // Only this chunk's part of the file is mapped at a time, so the
+                // mapping stays the same size however long the file is. Past
+                // the end of the file read() just produces silence.
+                auto fileRange = juce::Range<juce::int64>(start, start + numSamples)
+                                     .getIntersectionWith({ 0, reader.lengthInSamples });
+
+                if (mappedReader != nullptr && !fileRange.isEmpty() && !mappedReader->mapSectionOfFile(fileRange))
+                    return;
+
+                if (!reader.read(&buffer, 0, numSamples, start, true, true))
+                    return;
+
+                filledChunks.push(chunk);
+                start += numSamples;
+            }
+        }
+
+    private:
+        juce::AudioFormatReader& reader;
+        std::vector<juce::AudioBuffer<float>>& buffers;
+        ChunkQueue& freeChunks;
+        ChunkQueue& filledChunks;
+        const juce::int64 totalSamples;
+    };
+}
+
+juce::String renderStreaming(juce::AudioProcessor& processor,
+                             juce::AudioFormatReader& reader,
+                             std::unique_ptr<juce::AudioFormatWriter> writer,
+                             int blockSize)
+{
+    auto numChannels = static_cast<int>(reader.numChannels);
+    auto totalLength = reader.lengthInSamples;
+    auto latency = static_cast<juce::int64>(processor.getLatencySamples());
+
+    // Reading past the end of the file gives silence, which flushes the
+    // latency out of the processor.
+    auto totalToProcess = totalLength + latency;
+
+    std::vector<juce::AudioBuffer<float>> buffers;
+
+    for (int i = 0; i < numChunks; i++)
+        buffers.emplace_back(numChannels, blockSize);
+
+    ChunkQueue freeChunks, filledChunks;
+
+    for (int i = 0; i < numChunks; i++)
+        freeChunks.push(i);
+
+    juce::TimeSliceThread writerThread("Streaming writer");
+    writerThread.startThread();
+
+    auto threadedWriter = std::make_unique<juce::AudioFormatWriter::ThreadedWriter>(writer.release(), writerThread, blockSize * numChunks);
+
+    ReaderThread readerThread(reader, buffers, freeChunks, filledChunks, totalToProcess);
+    readerThread.startThread();
+
+    juce::MidiBuffer midi;
+    std::vector<const float*> channels(static_cast<size_t>(numChannels));
+    juce::int64 samplesToSkip = latency, numWritten = 0;
+    juce::String error;
+
+    for (juce::int64 start = 0; start < totalToProcess && error.isEmpty();)
+    {
+        int chunk;
+
+        if (!filledChunks.pop(chunk, pollIntervalMs))
+        {
+            // The reader only stops early when something went wrong.
+            if (!readerThread.isThreadRunning() && !filledChunks.pop(chunk, 0))
+                error = "Read failed";
+
+            continue;
+        }
+
+        auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(blockSize), totalToProcess - start));
+        juce::AudioBuffer<float> block(buffers[static_cast<size_t>(chunk)].getArrayOfWritePointers(), numChannels, numSamples);
+
+        processor.processBlock(block, midi);
+        start += numSamples;
+
+        auto numToSkip = static_cast<int>(juce::jmin(samplesToSkip, static_cast<juce::int64>(numSamples)));
+        samplesToSkip -= numToSkip;
+
+        auto numToWrite = static_cast<int>(juce::jmin(static_cast<juce::int64>(numSamples - numToSkip), totalLength - numWritten));
+
+        if (numToWrite > 0)
+        {
+            for (int channel = 0; channel < numChannels; channel++)
+                channels[static_cast<size_t>(channel)] = block.getReadPointer(channel, numToSkip);
+
+            // Only blocks when the disk has fallen a whole ring behind.
+            while (!threadedWriter->write(channels.data(), numToWrite))
+                juce::Thread::sleep(1);
+
+            numWritten += numToWrite;
+        }
+
+        freeChunks.push(chunk);
+    }
+
+    readerThread.stopThread(-1);
+
+    // Writes out whatever is still queued.
+    threadedWriter.reset();
+
+    return error;
+}
@@ -0,0 +1,31 @@
+/*
+  ==============================================================================
+
+    StreamingRender.h
+    Created: 18 Oct 2026 7:48:20pm
+    Author:  User
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Renders a whole file through a prepared processor in three overlapping
+// stages, so disk and DSP never wait on each other:
+//
+//  - a reader thread filling fixed size chunks, through a window of the file
+//    mapped at a time when the reader is a MemoryMappedAudioFormatReader,
+//  - the processor running on the calling thread, one chunk per processBlock,
+//  - an AudioFormatWriter::ThreadedWriter draining to disk.
+//
+// Chunks are handed between the stages through bounded lock-free queues
+// around a fixed ring of buffers, so memory use doesn't grow with the file.
+// The processor's latency is compensated as in the blocking render.
+//
+// Returns an error message, or an empty string on success.
+juce::String renderStreaming(juce::AudioProcessor& processor,
+                             juce::AudioFormatReader& reader,
+                             std::unique_ptr<juce::AudioFormatWriter> writer,
+                             int blockSize);
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Prints what every running SimpleEQ instance on this machine publishes
+    through the telemetry file (see Source/TelemetryExport.h):
+
+        TelemetryMonitor [--interval <ms>] [--once] [--file <path>]
+
+        --interval <ms>   how often to poll, defaults to 1000
+        --once            prints one report and exits
+        --file <path>     reads another telemetry file than the default
+
+    Reading never blocks the instances being watched. Instances only publish
+    when their host was started with SIMPLEEQ_TELEMETRY=1 in its environment.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/TelemetryExport.h"
+
+namespace
+{
+    juce::String percent(float load)
+    {
+        return juce::String(load * 100.f, 1) + "%";
+    }
+
+    void printReport(const Telemetry::Reader& reader)
+    {
+        auto names = reader.getParameterNames();
+        auto snapshots = reader.read();
+
+        std::cout << juce::Time::getCurrentTime().toString(false, true, true, true) << ": "
+                  << snapshots.size() << " instances" << std::endl;
+
+        if (auto numOverflowed = reader.getNumOverflowed(); numOverflowed > 0)
+            std::cout << "  " << numOverflowed << " instances found every one of the " << Telemetry::maxInstances
+                      << " records taken and aren't shown" << std::endl;
+
+        for (auto& snapshot : snapshots)
+        {
+            std::cout << "  pid " << snapshot.processId
+                      << " #" << juce::String::toHexString(static_cast<int>(snapshot.instanceId))
+                      << "  " << snapshot.sampleRate << " Hz, " << snapshot.blockSize << " samples"
+                      << "  load " << percent(snapshot.averageLoad) << " (peak " << percent(snapshot.peakLoad) << ")"
+                      << ", " << juce::String(snapshot.averageBlockMicroseconds, 1) << " us/block" << std::endl;
+
+            std::cout << "    " << snapshot.numBlocks << " blocks, "
+                      << snapshot.numNearBudget << " near budget, "
+                      << snapshot.numOverBudget << " over budget, "
+                      << snapshot.numRecomputes << " redesigns" << std::endl;
+
+            auto numLookups = snapshot.numCacheHits + snapshot.numCacheMisses;
+
+            if (numLookups > 0)
+                std::cout << "    coefficient cache (process wide): " << snapshot.numCacheHits << " of " << numLookups
+                          << " lookups hit, " << percent(static_cast<float>(snapshot.numCacheHits) / numLookups) << std::endl;
+
+            juce::StringArray parameters;
+
+            for (int i = 0; i < snapshot.numParameters; i++)
+            {
+                auto name = i < names.size() ? names[i] : juce::String(i);
+                parameters.add(name + "=" + juce::String(snapshot.parameters[static_cast<size_t>(i)], 2));
+            }
+
+            std::cout << "    " << parameters.joinIntoString(", ") << std::endl;
+        }
+    }
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    auto file = Telemetry::getDefaultFile();
+    int intervalMs = 1000;
+    bool once = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        juce::String arg(argv[i]);
+
+        if (arg == "--interval" && i + 1 < argc)
+        {
+            intervalMs = juce::jmax(10, juce::String(argv[++i]).getIntValue());
+        }
+        else if (arg == "--once")
+        {
+            once = true;
+        }
+        else if (arg == "--file" && i + 1 < argc)
+        {
+            file = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "Usage: TelemetryMonitor [--interval <ms>] [--once] [--file <path>]" << std::endl;
+            return 1;
+        }
+    }
+
+    for (;;)
+    {
+        // Reopened each time, as the file only appears once an instance starts.
+        Telemetry::Reader reader(file);
+
+        if (reader.isOpen())
+            printReport(reader);
+        else
+            std::cout << "No instances publishing to " << file.getFullPathName()
+                      << " (hosts need SIMPLEEQ_TELEMETRY=1 set)" << std::endl;
+
+        if (once)
+            return 0;
+
+        juce::Thread::sleep(intervalMs);
+    }
+}